@@ -0,0 +1,120 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/any_cast/CMakeLists.txt"
+  "/root/repo/examples/args/CMakeLists.txt"
+  "/root/repo/examples/assert_macros/CMakeLists.txt"
+  "/root/repo/examples/dyn_cast/CMakeLists.txt"
+  "/root/repo/examples/embedded_obj/CMakeLists.txt"
+  "/root/repo/examples/extra_data/CMakeLists.txt"
+  "/root/repo/examples/rcp/CMakeLists.txt"
+  "/root/repo/examples/release_rcps/CMakeLists.txt"
+  "/root/repo/examples/show/CMakeLists.txt"
+  "/root/repo/examples/startup/CMakeLists.txt"
+  "/root/repo/examples/test_memory/CMakeLists.txt"
+  "/root/repo/examples/type_name/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/Teuchos_config.h.in"
+  "/root/repo/test/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Teuchos_config.h"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/rcp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/args/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/show/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/test_memory/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/startup/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/release_rcps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/extra_data/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/any_cast/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/type_name/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/dyn_cast/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/embedded_obj/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/assert_macros/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/CMakeFiles/teuchosmm.dir/DependInfo.cmake"
+  "src/CMakeFiles/teuchosmm_no_exceptions.dir/DependInfo.cmake"
+  "examples/rcp/CMakeFiles/rcp.dir/DependInfo.cmake"
+  "examples/args/CMakeFiles/args.dir/DependInfo.cmake"
+  "examples/show/CMakeFiles/show.dir/DependInfo.cmake"
+  "examples/test_memory/CMakeFiles/test_memory.dir/DependInfo.cmake"
+  "examples/startup/CMakeFiles/startup.dir/DependInfo.cmake"
+  "examples/release_rcps/CMakeFiles/release_rcps.dir/DependInfo.cmake"
+  "examples/extra_data/CMakeFiles/extra_data.dir/DependInfo.cmake"
+  "examples/any_cast/CMakeFiles/any_cast.dir/DependInfo.cmake"
+  "examples/type_name/CMakeFiles/type_name.dir/DependInfo.cmake"
+  "examples/dyn_cast/CMakeFiles/dyn_cast.dir/DependInfo.cmake"
+  "examples/embedded_obj/CMakeFiles/embedded_obj.dir/DependInfo.cmake"
+  "examples/assert_macros/CMakeFiles/assert_macros.dir/DependInfo.cmake"
+  "test/CMakeFiles/ActiveRCPNodesSetup_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/DynCast_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/LazyRCP_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/RCPAllocator_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/RCPBulk_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/RCPCacheLineAligned_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/RCPExtraData_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/RCPFromRef_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/RCPDestroyCallback_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/RCPEmbeddedObj_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/RCPFastExit_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/RCPObjectPool_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/RCPPolicy_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/RCPRegion_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/ReleaseRCPs_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/SlotMap_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/TestForException_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/TypeNameTraits_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/WeakRCPCache_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/RCPThreadSafe_UnitTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/NoExceptions_UnitTests.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/any_cast.dir/main.cpp.o"
+  "CMakeFiles/any_cast.dir/main.cpp.o.d"
+  "any_cast"
+  "any_cast.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/any_cast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/args.dir/main.cpp.o"
+  "CMakeFiles/args.dir/main.cpp.o.d"
+  "args"
+  "args.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/args.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
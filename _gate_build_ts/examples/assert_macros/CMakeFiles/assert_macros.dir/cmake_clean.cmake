@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/assert_macros.dir/main.cpp.o"
+  "CMakeFiles/assert_macros.dir/main.cpp.o.d"
+  "assert_macros"
+  "assert_macros.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/assert_macros.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
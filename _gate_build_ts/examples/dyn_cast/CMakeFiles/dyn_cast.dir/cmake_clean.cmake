@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dyn_cast.dir/main.cpp.o"
+  "CMakeFiles/dyn_cast.dir/main.cpp.o.d"
+  "dyn_cast"
+  "dyn_cast.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dyn_cast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/embedded_obj.dir/main.cpp.o"
+  "CMakeFiles/embedded_obj.dir/main.cpp.o.d"
+  "embedded_obj"
+  "embedded_obj.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/embedded_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/extra_data.dir/main.cpp.o"
+  "CMakeFiles/extra_data.dir/main.cpp.o.d"
+  "extra_data"
+  "extra_data.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/extra_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
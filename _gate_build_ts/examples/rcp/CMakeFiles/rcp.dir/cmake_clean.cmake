@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rcp.dir/main.cpp.o"
+  "CMakeFiles/rcp.dir/main.cpp.o.d"
+  "rcp"
+  "rcp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rcp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/release_rcps.dir/main.cpp.o"
+  "CMakeFiles/release_rcps.dir/main.cpp.o.d"
+  "release_rcps"
+  "release_rcps.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/release_rcps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/show.dir/main.cpp.o"
+  "CMakeFiles/show.dir/main.cpp.o.d"
+  "show"
+  "show.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/show.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,220 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/startup/main.cpp" "examples/startup/CMakeFiles/startup.dir/main.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/main.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_1.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_1.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_1.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_10.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_10.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_10.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_100.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_100.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_100.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_101.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_101.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_101.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_102.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_102.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_102.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_103.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_103.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_103.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_104.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_104.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_104.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_105.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_105.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_105.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_106.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_106.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_106.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_107.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_107.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_107.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_108.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_108.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_108.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_109.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_109.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_109.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_11.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_11.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_11.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_110.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_110.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_110.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_111.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_111.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_111.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_112.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_112.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_112.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_113.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_113.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_113.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_114.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_114.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_114.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_115.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_115.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_115.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_116.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_116.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_116.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_117.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_117.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_117.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_118.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_118.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_118.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_119.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_119.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_119.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_12.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_12.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_12.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_120.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_120.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_120.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_121.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_121.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_121.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_122.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_122.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_122.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_123.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_123.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_123.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_124.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_124.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_124.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_125.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_125.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_125.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_126.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_126.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_126.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_127.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_127.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_127.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_128.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_128.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_128.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_129.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_129.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_129.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_13.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_13.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_13.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_130.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_130.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_130.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_131.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_131.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_131.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_132.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_132.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_132.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_133.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_133.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_133.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_134.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_134.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_134.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_135.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_135.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_135.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_136.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_136.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_136.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_137.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_137.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_137.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_138.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_138.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_138.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_139.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_139.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_139.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_14.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_14.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_14.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_140.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_140.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_140.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_141.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_141.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_141.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_142.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_142.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_142.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_143.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_143.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_143.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_144.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_144.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_144.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_145.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_145.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_145.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_146.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_146.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_146.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_147.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_147.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_147.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_148.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_148.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_148.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_149.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_149.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_149.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_15.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_15.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_15.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_150.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_150.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_150.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_151.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_151.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_151.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_152.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_152.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_152.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_153.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_153.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_153.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_154.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_154.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_154.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_155.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_155.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_155.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_156.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_156.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_156.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_157.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_157.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_157.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_158.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_158.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_158.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_159.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_159.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_159.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_16.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_16.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_16.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_160.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_160.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_160.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_161.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_161.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_161.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_162.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_162.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_162.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_163.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_163.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_163.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_164.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_164.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_164.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_165.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_165.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_165.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_166.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_166.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_166.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_167.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_167.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_167.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_168.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_168.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_168.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_169.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_169.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_169.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_17.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_17.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_17.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_170.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_170.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_170.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_171.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_171.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_171.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_172.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_172.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_172.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_173.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_173.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_173.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_174.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_174.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_174.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_175.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_175.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_175.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_176.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_176.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_176.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_177.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_177.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_177.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_178.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_178.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_178.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_179.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_179.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_179.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_18.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_18.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_18.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_180.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_180.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_180.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_181.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_181.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_181.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_182.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_182.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_182.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_183.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_183.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_183.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_184.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_184.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_184.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_185.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_185.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_185.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_186.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_186.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_186.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_187.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_187.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_187.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_188.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_188.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_188.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_189.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_189.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_189.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_19.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_19.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_19.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_190.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_190.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_190.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_191.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_191.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_191.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_192.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_192.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_192.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_193.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_193.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_193.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_194.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_194.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_194.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_195.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_195.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_195.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_196.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_196.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_196.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_197.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_197.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_197.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_198.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_198.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_198.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_199.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_199.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_199.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_2.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_2.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_2.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_20.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_20.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_20.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_200.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_200.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_200.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_21.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_21.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_21.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_22.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_22.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_22.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_23.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_23.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_23.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_24.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_24.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_24.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_25.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_25.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_25.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_26.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_26.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_26.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_27.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_27.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_27.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_28.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_28.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_28.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_29.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_29.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_29.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_3.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_3.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_3.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_30.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_30.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_30.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_31.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_31.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_31.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_32.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_32.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_32.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_33.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_33.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_33.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_34.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_34.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_34.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_35.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_35.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_35.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_36.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_36.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_36.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_37.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_37.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_37.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_38.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_38.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_38.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_39.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_39.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_39.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_4.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_4.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_4.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_40.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_40.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_40.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_41.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_41.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_41.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_42.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_42.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_42.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_43.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_43.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_43.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_44.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_44.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_44.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_45.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_45.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_45.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_46.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_46.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_46.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_47.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_47.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_47.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_48.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_48.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_48.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_49.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_49.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_49.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_5.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_5.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_5.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_50.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_50.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_50.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_51.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_51.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_51.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_52.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_52.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_52.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_53.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_53.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_53.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_54.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_54.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_54.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_55.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_55.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_55.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_56.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_56.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_56.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_57.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_57.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_57.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_58.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_58.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_58.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_59.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_59.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_59.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_6.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_6.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_6.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_60.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_60.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_60.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_61.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_61.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_61.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_62.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_62.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_62.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_63.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_63.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_63.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_64.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_64.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_64.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_65.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_65.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_65.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_66.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_66.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_66.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_67.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_67.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_67.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_68.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_68.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_68.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_69.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_69.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_69.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_7.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_7.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_7.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_70.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_70.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_70.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_71.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_71.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_71.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_72.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_72.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_72.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_73.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_73.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_73.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_74.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_74.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_74.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_75.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_75.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_75.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_76.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_76.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_76.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_77.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_77.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_77.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_78.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_78.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_78.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_79.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_79.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_79.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_8.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_8.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_8.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_80.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_80.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_80.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_81.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_81.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_81.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_82.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_82.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_82.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_83.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_83.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_83.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_84.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_84.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_84.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_85.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_85.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_85.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_86.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_86.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_86.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_87.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_87.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_87.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_88.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_88.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_88.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_89.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_89.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_89.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_9.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_9.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_9.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_90.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_90.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_90.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_91.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_91.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_91.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_92.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_92.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_92.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_93.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_93.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_93.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_94.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_94.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_94.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_95.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_95.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_95.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_96.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_96.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_96.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_97.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_97.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_97.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_98.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_98.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_98.cpp.o.d"
+  "/root/repo/_gate_build_ts/examples/startup/startup_tu_99.cpp" "examples/startup/CMakeFiles/startup.dir/startup_tu_99.cpp.o" "gcc" "examples/startup/CMakeFiles/startup.dir/startup_tu_99.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_ts/src/CMakeFiles/teuchosmm.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
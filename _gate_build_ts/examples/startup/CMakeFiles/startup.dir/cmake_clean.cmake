@@ -0,0 +1,411 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/startup.dir/main.cpp.o"
+  "CMakeFiles/startup.dir/main.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_1.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_1.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_10.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_10.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_100.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_100.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_101.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_101.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_102.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_102.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_103.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_103.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_104.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_104.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_105.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_105.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_106.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_106.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_107.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_107.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_108.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_108.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_109.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_109.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_11.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_11.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_110.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_110.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_111.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_111.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_112.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_112.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_113.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_113.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_114.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_114.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_115.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_115.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_116.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_116.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_117.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_117.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_118.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_118.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_119.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_119.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_12.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_12.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_120.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_120.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_121.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_121.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_122.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_122.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_123.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_123.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_124.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_124.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_125.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_125.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_126.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_126.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_127.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_127.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_128.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_128.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_129.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_129.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_13.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_13.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_130.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_130.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_131.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_131.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_132.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_132.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_133.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_133.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_134.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_134.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_135.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_135.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_136.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_136.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_137.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_137.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_138.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_138.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_139.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_139.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_14.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_14.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_140.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_140.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_141.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_141.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_142.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_142.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_143.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_143.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_144.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_144.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_145.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_145.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_146.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_146.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_147.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_147.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_148.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_148.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_149.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_149.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_15.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_15.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_150.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_150.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_151.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_151.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_152.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_152.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_153.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_153.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_154.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_154.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_155.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_155.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_156.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_156.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_157.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_157.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_158.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_158.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_159.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_159.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_16.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_16.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_160.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_160.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_161.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_161.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_162.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_162.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_163.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_163.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_164.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_164.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_165.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_165.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_166.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_166.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_167.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_167.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_168.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_168.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_169.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_169.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_17.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_17.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_170.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_170.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_171.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_171.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_172.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_172.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_173.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_173.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_174.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_174.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_175.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_175.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_176.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_176.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_177.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_177.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_178.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_178.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_179.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_179.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_18.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_18.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_180.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_180.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_181.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_181.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_182.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_182.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_183.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_183.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_184.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_184.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_185.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_185.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_186.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_186.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_187.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_187.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_188.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_188.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_189.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_189.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_19.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_19.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_190.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_190.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_191.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_191.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_192.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_192.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_193.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_193.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_194.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_194.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_195.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_195.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_196.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_196.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_197.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_197.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_198.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_198.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_199.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_199.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_2.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_2.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_20.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_20.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_200.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_200.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_21.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_21.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_22.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_22.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_23.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_23.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_24.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_24.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_25.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_25.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_26.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_26.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_27.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_27.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_28.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_28.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_29.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_29.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_3.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_3.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_30.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_30.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_31.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_31.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_32.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_32.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_33.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_33.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_34.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_34.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_35.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_35.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_36.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_36.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_37.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_37.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_38.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_38.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_39.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_39.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_4.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_4.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_40.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_40.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_41.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_41.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_42.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_42.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_43.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_43.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_44.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_44.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_45.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_45.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_46.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_46.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_47.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_47.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_48.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_48.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_49.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_49.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_5.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_5.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_50.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_50.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_51.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_51.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_52.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_52.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_53.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_53.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_54.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_54.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_55.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_55.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_56.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_56.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_57.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_57.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_58.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_58.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_59.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_59.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_6.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_6.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_60.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_60.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_61.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_61.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_62.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_62.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_63.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_63.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_64.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_64.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_65.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_65.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_66.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_66.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_67.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_67.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_68.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_68.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_69.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_69.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_7.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_7.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_70.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_70.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_71.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_71.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_72.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_72.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_73.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_73.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_74.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_74.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_75.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_75.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_76.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_76.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_77.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_77.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_78.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_78.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_79.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_79.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_8.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_8.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_80.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_80.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_81.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_81.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_82.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_82.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_83.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_83.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_84.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_84.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_85.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_85.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_86.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_86.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_87.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_87.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_88.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_88.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_89.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_89.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_9.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_9.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_90.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_90.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_91.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_91.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_92.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_92.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_93.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_93.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_94.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_94.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_95.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_95.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_96.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_96.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_97.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_97.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_98.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_98.cpp.o.d"
+  "CMakeFiles/startup.dir/startup_tu_99.cpp.o"
+  "CMakeFiles/startup.dir/startup_tu_99.cpp.o.d"
+  "startup"
+  "startup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/startup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,2 @@
+#include "Teuchos_RCP.hpp"
+int startup_tu_125() { return Teuchos::rcp(new int(125)).count(); }
@@ -0,0 +1,2 @@
+#include "Teuchos_RCP.hpp"
+int startup_tu_165() { return Teuchos::rcp(new int(165)).count(); }
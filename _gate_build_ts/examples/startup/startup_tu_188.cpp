@@ -0,0 +1,2 @@
+#include "Teuchos_RCP.hpp"
+int startup_tu_188() { return Teuchos::rcp(new int(188)).count(); }
@@ -0,0 +1,2 @@
+#include "Teuchos_RCP.hpp"
+int startup_tu_22() { return Teuchos::rcp(new int(22)).count(); }
@@ -0,0 +1,2 @@
+#include "Teuchos_RCP.hpp"
+int startup_tu_55() { return Teuchos::rcp(new int(55)).count(); }
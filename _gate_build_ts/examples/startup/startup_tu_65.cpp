@@ -0,0 +1,2 @@
+#include "Teuchos_RCP.hpp"
+int startup_tu_65() { return Teuchos::rcp(new int(65)).count(); }
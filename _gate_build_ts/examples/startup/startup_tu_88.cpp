@@ -0,0 +1,2 @@
+#include "Teuchos_RCP.hpp"
+int startup_tu_88() { return Teuchos::rcp(new int(88)).count(); }
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/type_name.dir/main.cpp.o"
+  "CMakeFiles/type_name.dir/main.cpp.o.d"
+  "type_name"
+  "type_name.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/type_name.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
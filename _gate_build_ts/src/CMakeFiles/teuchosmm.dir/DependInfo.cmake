@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Teuchos_Ptr.cpp" "src/CMakeFiles/teuchosmm.dir/Teuchos_Ptr.cpp.o" "gcc" "src/CMakeFiles/teuchosmm.dir/Teuchos_Ptr.cpp.o.d"
+  "/root/repo/src/Teuchos_RCPNode.cpp" "src/CMakeFiles/teuchosmm.dir/Teuchos_RCPNode.cpp.o" "gcc" "src/CMakeFiles/teuchosmm.dir/Teuchos_RCPNode.cpp.o.d"
+  "/root/repo/src/Teuchos_TestForException.cpp" "src/CMakeFiles/teuchosmm.dir/Teuchos_TestForException.cpp.o" "gcc" "src/CMakeFiles/teuchosmm.dir/Teuchos_TestForException.cpp.o.d"
+  "/root/repo/src/Teuchos_TypeNameTraits.cpp" "src/CMakeFiles/teuchosmm.dir/Teuchos_TypeNameTraits.cpp.o" "gcc" "src/CMakeFiles/teuchosmm.dir/Teuchos_TypeNameTraits.cpp.o.d"
+  "/root/repo/src/Teuchos_any.cpp" "src/CMakeFiles/teuchosmm.dir/Teuchos_any.cpp.o" "gcc" "src/CMakeFiles/teuchosmm.dir/Teuchos_any.cpp.o.d"
+  "/root/repo/src/Teuchos_dyn_cast.cpp" "src/CMakeFiles/teuchosmm.dir/Teuchos_dyn_cast.cpp.o" "gcc" "src/CMakeFiles/teuchosmm.dir/Teuchos_dyn_cast.cpp.o.d"
+  "/root/repo/src/Teuchos_stacktrace.cpp" "src/CMakeFiles/teuchosmm.dir/Teuchos_stacktrace.cpp.o" "gcc" "src/CMakeFiles/teuchosmm.dir/Teuchos_stacktrace.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
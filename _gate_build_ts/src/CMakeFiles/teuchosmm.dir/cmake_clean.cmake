@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/teuchosmm.dir/Teuchos_Ptr.cpp.o"
+  "CMakeFiles/teuchosmm.dir/Teuchos_Ptr.cpp.o.d"
+  "CMakeFiles/teuchosmm.dir/Teuchos_RCPNode.cpp.o"
+  "CMakeFiles/teuchosmm.dir/Teuchos_RCPNode.cpp.o.d"
+  "CMakeFiles/teuchosmm.dir/Teuchos_TestForException.cpp.o"
+  "CMakeFiles/teuchosmm.dir/Teuchos_TestForException.cpp.o.d"
+  "CMakeFiles/teuchosmm.dir/Teuchos_TypeNameTraits.cpp.o"
+  "CMakeFiles/teuchosmm.dir/Teuchos_TypeNameTraits.cpp.o.d"
+  "CMakeFiles/teuchosmm.dir/Teuchos_any.cpp.o"
+  "CMakeFiles/teuchosmm.dir/Teuchos_any.cpp.o.d"
+  "CMakeFiles/teuchosmm.dir/Teuchos_dyn_cast.cpp.o"
+  "CMakeFiles/teuchosmm.dir/Teuchos_dyn_cast.cpp.o.d"
+  "CMakeFiles/teuchosmm.dir/Teuchos_stacktrace.cpp.o"
+  "CMakeFiles/teuchosmm.dir/Teuchos_stacktrace.cpp.o.d"
+  "libteuchosmm.pdb"
+  "libteuchosmm.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/teuchosmm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_Ptr.cpp.o"
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_Ptr.cpp.o.d"
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_RCPNode.cpp.o"
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_RCPNode.cpp.o.d"
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_TestForException.cpp.o"
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_TestForException.cpp.o.d"
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_TypeNameTraits.cpp.o"
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_TypeNameTraits.cpp.o.d"
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_any.cpp.o"
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_any.cpp.o.d"
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_dyn_cast.cpp.o"
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_dyn_cast.cpp.o.d"
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_stacktrace.cpp.o"
+  "CMakeFiles/teuchosmm_no_exceptions.dir/Teuchos_stacktrace.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/teuchosmm_no_exceptions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "ActiveRCPNodesSetup_UnitTests"
+  "ActiveRCPNodesSetup_UnitTests.pdb"
+  "CMakeFiles/ActiveRCPNodesSetup_UnitTests.dir/ActiveRCPNodesSetup_UnitTests.cpp.o"
+  "CMakeFiles/ActiveRCPNodesSetup_UnitTests.dir/ActiveRCPNodesSetup_UnitTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ActiveRCPNodesSetup_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
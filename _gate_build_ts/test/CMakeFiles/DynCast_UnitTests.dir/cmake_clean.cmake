@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DynCast_UnitTests.dir/DynCast_UnitTests.cpp.o"
+  "CMakeFiles/DynCast_UnitTests.dir/DynCast_UnitTests.cpp.o.d"
+  "DynCast_UnitTests"
+  "DynCast_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DynCast_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LazyRCP_UnitTests.dir/LazyRCP_UnitTests.cpp.o"
+  "CMakeFiles/LazyRCP_UnitTests.dir/LazyRCP_UnitTests.cpp.o.d"
+  "LazyRCP_UnitTests"
+  "LazyRCP_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LazyRCP_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/NoExceptions_UnitTests.dir/NoExceptions_UnitTests.cpp.o"
+  "CMakeFiles/NoExceptions_UnitTests.dir/NoExceptions_UnitTests.cpp.o.d"
+  "NoExceptions_UnitTests"
+  "NoExceptions_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/NoExceptions_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RCPAllocator_UnitTests.dir/RCPAllocator_UnitTests.cpp.o"
+  "CMakeFiles/RCPAllocator_UnitTests.dir/RCPAllocator_UnitTests.cpp.o.d"
+  "RCPAllocator_UnitTests"
+  "RCPAllocator_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RCPAllocator_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RCPBulk_UnitTests.dir/RCPBulk_UnitTests.cpp.o"
+  "CMakeFiles/RCPBulk_UnitTests.dir/RCPBulk_UnitTests.cpp.o.d"
+  "RCPBulk_UnitTests"
+  "RCPBulk_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RCPBulk_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
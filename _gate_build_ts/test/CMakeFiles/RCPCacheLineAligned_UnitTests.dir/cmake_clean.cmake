@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RCPCacheLineAligned_UnitTests.dir/RCPCacheLineAligned_UnitTests.cpp.o"
+  "CMakeFiles/RCPCacheLineAligned_UnitTests.dir/RCPCacheLineAligned_UnitTests.cpp.o.d"
+  "RCPCacheLineAligned_UnitTests"
+  "RCPCacheLineAligned_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RCPCacheLineAligned_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RCPDestroyCallback_UnitTests.dir/RCPDestroyCallback_UnitTests.cpp.o"
+  "CMakeFiles/RCPDestroyCallback_UnitTests.dir/RCPDestroyCallback_UnitTests.cpp.o.d"
+  "RCPDestroyCallback_UnitTests"
+  "RCPDestroyCallback_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RCPDestroyCallback_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
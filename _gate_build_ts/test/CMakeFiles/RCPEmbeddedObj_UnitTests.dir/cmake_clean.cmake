@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RCPEmbeddedObj_UnitTests.dir/RCPEmbeddedObj_UnitTests.cpp.o"
+  "CMakeFiles/RCPEmbeddedObj_UnitTests.dir/RCPEmbeddedObj_UnitTests.cpp.o.d"
+  "RCPEmbeddedObj_UnitTests"
+  "RCPEmbeddedObj_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RCPEmbeddedObj_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RCPExtraData_UnitTests.dir/RCPExtraData_UnitTests.cpp.o"
+  "CMakeFiles/RCPExtraData_UnitTests.dir/RCPExtraData_UnitTests.cpp.o.d"
+  "RCPExtraData_UnitTests"
+  "RCPExtraData_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RCPExtraData_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
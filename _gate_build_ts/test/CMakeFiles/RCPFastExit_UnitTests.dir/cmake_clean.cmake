@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RCPFastExit_UnitTests.dir/RCPFastExit_UnitTests.cpp.o"
+  "CMakeFiles/RCPFastExit_UnitTests.dir/RCPFastExit_UnitTests.cpp.o.d"
+  "RCPFastExit_UnitTests"
+  "RCPFastExit_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RCPFastExit_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
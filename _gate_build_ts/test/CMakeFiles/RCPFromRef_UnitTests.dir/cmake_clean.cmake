@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RCPFromRef_UnitTests.dir/RCPFromRef_UnitTests.cpp.o"
+  "CMakeFiles/RCPFromRef_UnitTests.dir/RCPFromRef_UnitTests.cpp.o.d"
+  "RCPFromRef_UnitTests"
+  "RCPFromRef_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RCPFromRef_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
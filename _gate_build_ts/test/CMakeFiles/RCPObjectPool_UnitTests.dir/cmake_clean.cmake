@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RCPObjectPool_UnitTests.dir/RCPObjectPool_UnitTests.cpp.o"
+  "CMakeFiles/RCPObjectPool_UnitTests.dir/RCPObjectPool_UnitTests.cpp.o.d"
+  "RCPObjectPool_UnitTests"
+  "RCPObjectPool_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RCPObjectPool_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
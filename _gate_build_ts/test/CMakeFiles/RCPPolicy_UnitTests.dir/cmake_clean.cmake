@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RCPPolicy_UnitTests.dir/RCPPolicy_UnitTests.cpp.o"
+  "CMakeFiles/RCPPolicy_UnitTests.dir/RCPPolicy_UnitTests.cpp.o.d"
+  "RCPPolicy_UnitTests"
+  "RCPPolicy_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RCPPolicy_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RCPRegion_UnitTests.dir/RCPRegion_UnitTests.cpp.o"
+  "CMakeFiles/RCPRegion_UnitTests.dir/RCPRegion_UnitTests.cpp.o.d"
+  "RCPRegion_UnitTests"
+  "RCPRegion_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RCPRegion_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
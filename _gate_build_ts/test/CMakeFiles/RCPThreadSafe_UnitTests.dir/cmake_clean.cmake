@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RCPThreadSafe_UnitTests.dir/RCPThreadSafe_UnitTests.cpp.o"
+  "CMakeFiles/RCPThreadSafe_UnitTests.dir/RCPThreadSafe_UnitTests.cpp.o.d"
+  "RCPThreadSafe_UnitTests"
+  "RCPThreadSafe_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RCPThreadSafe_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
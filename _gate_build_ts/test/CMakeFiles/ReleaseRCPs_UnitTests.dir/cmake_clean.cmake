@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ReleaseRCPs_UnitTests.dir/ReleaseRCPs_UnitTests.cpp.o"
+  "CMakeFiles/ReleaseRCPs_UnitTests.dir/ReleaseRCPs_UnitTests.cpp.o.d"
+  "ReleaseRCPs_UnitTests"
+  "ReleaseRCPs_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ReleaseRCPs_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
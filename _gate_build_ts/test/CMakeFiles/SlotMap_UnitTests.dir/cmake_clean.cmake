@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SlotMap_UnitTests.dir/SlotMap_UnitTests.cpp.o"
+  "CMakeFiles/SlotMap_UnitTests.dir/SlotMap_UnitTests.cpp.o.d"
+  "SlotMap_UnitTests"
+  "SlotMap_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SlotMap_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
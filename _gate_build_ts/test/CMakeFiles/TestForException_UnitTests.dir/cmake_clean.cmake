@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TestForException_UnitTests.dir/TestForException_UnitTests.cpp.o"
+  "CMakeFiles/TestForException_UnitTests.dir/TestForException_UnitTests.cpp.o.d"
+  "TestForException_UnitTests"
+  "TestForException_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestForException_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
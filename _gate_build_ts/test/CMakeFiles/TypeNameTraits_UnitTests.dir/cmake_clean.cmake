@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TypeNameTraits_UnitTests.dir/TypeNameTraits_UnitTests.cpp.o"
+  "CMakeFiles/TypeNameTraits_UnitTests.dir/TypeNameTraits_UnitTests.cpp.o.d"
+  "TypeNameTraits_UnitTests"
+  "TypeNameTraits_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TypeNameTraits_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
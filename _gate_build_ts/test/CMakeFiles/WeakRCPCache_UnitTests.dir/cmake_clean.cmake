@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WeakRCPCache_UnitTests.dir/WeakRCPCache_UnitTests.cpp.o"
+  "CMakeFiles/WeakRCPCache_UnitTests.dir/WeakRCPCache_UnitTests.cpp.o.d"
+  "WeakRCPCache_UnitTests"
+  "WeakRCPCache_UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WeakRCPCache_UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
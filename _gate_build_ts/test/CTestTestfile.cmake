@@ -0,0 +1,48 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_gate_build_ts/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ActiveRCPNodesSetup_UnitTests "ActiveRCPNodesSetup_UnitTests")
+set_tests_properties(ActiveRCPNodesSetup_UnitTests PROPERTIES  FAIL_REGULAR_EXPRESSION "were created but have" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;12;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(DynCast_UnitTests "DynCast_UnitTests")
+set_tests_properties(DynCast_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;15;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(LazyRCP_UnitTests "LazyRCP_UnitTests")
+set_tests_properties(LazyRCP_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;16;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(RCPAllocator_UnitTests "RCPAllocator_UnitTests")
+set_tests_properties(RCPAllocator_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;17;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(RCPBulk_UnitTests "RCPBulk_UnitTests")
+set_tests_properties(RCPBulk_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;18;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(RCPCacheLineAligned_UnitTests "RCPCacheLineAligned_UnitTests")
+set_tests_properties(RCPCacheLineAligned_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;19;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(RCPExtraData_UnitTests "RCPExtraData_UnitTests")
+set_tests_properties(RCPExtraData_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;20;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(RCPFromRef_UnitTests "RCPFromRef_UnitTests")
+set_tests_properties(RCPFromRef_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;21;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(RCPDestroyCallback_UnitTests "RCPDestroyCallback_UnitTests")
+set_tests_properties(RCPDestroyCallback_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;22;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(RCPEmbeddedObj_UnitTests "RCPEmbeddedObj_UnitTests")
+set_tests_properties(RCPEmbeddedObj_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;23;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(RCPFastExit_UnitTests "RCPFastExit_UnitTests")
+set_tests_properties(RCPFastExit_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;24;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(RCPObjectPool_UnitTests "RCPObjectPool_UnitTests")
+set_tests_properties(RCPObjectPool_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;25;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(RCPPolicy_UnitTests "RCPPolicy_UnitTests")
+set_tests_properties(RCPPolicy_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;26;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(RCPRegion_UnitTests "RCPRegion_UnitTests")
+set_tests_properties(RCPRegion_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;27;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(ReleaseRCPs_UnitTests "ReleaseRCPs_UnitTests")
+set_tests_properties(ReleaseRCPs_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;28;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(SlotMap_UnitTests "SlotMap_UnitTests")
+set_tests_properties(SlotMap_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;29;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(TestForException_UnitTests "TestForException_UnitTests")
+set_tests_properties(TestForException_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;30;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(TypeNameTraits_UnitTests "TypeNameTraits_UnitTests")
+set_tests_properties(TypeNameTraits_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;31;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(WeakRCPCache_UnitTests "WeakRCPCache_UnitTests")
+set_tests_properties(WeakRCPCache_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;32;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(RCPThreadSafe_UnitTests "RCPThreadSafe_UnitTests")
+set_tests_properties(RCPThreadSafe_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;9;add_test;/root/repo/test/CMakeLists.txt;35;teuchos_add_unit_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(NoExceptions_UnitTests "NoExceptions_UnitTests")
+set_tests_properties(NoExceptions_UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;47;add_test;/root/repo/test/CMakeLists.txt;0;")
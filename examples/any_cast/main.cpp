@@ -0,0 +1,85 @@
+// Times any_cast<int>() next to a copy of the checks that any_cast() used
+// to do on every call (build the type name, compare the type_info and
+// dynamic_cast the holder), and a by-name extra data lookup of an RCP.
+//
+//   $ ./any_cast [numIters]
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_any.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <sys/time.h>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+using Teuchos::any;
+
+namespace {
+
+double wallTime()
+{
+  timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec * 1e9 + tv.tv_usec * 1e3;
+}
+
+struct A { int a; };
+
+// The holder of the old any
+struct placeholder {
+  virtual ~placeholder() {}
+  virtual const std::type_info& type() const = 0;
+};
+
+template<class T>
+struct holder : placeholder {
+  holder(const T &_held) : held(_held) {}
+  const std::type_info& type() const { return typeid(T); }
+  T held;
+};
+
+template<class T>
+T& oldAnyCast(placeholder *content)
+{
+  const std::string typeName = Teuchos::TypeNameTraits<T>::name();
+  if (!content || content->type() != typeid(T))
+    throw Teuchos::bad_any_cast(typeName);
+  holder<T> *h = dynamic_cast<holder<T>*>(content);
+  if (!h)
+    throw std::logic_error(typeName);
+  return h->held;
+}
+
+volatile int sink = 0;
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+  const int numIters = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  any value(5);
+  placeholder *volatile oldValue = new holder<int>(5);
+  RCP<double> p = rcp(new double(0.0));
+  Teuchos::set_extra_data(rcp(new A), "a", Teuchos::inOutArg(p));
+
+  double start = wallTime();
+  for (int i = 0; i < numIters; ++i)
+    sink += Teuchos::any_cast<int>(value);
+  const double cast = (wallTime() - start) / numIters;
+
+  start = wallTime();
+  for (int i = 0; i < numIters; ++i)
+    sink += oldAnyCast<int>(oldValue);
+  const double oldCast = (wallTime() - start) / numIters;
+
+  start = wallTime();
+  for (int i = 0; i < numIters; ++i)
+    sink += Teuchos::get_extra_data<RCP<A> >(p, "a").count();
+  const double extraData = (wallTime() - start) / numIters;
+
+  std::printf("any_cast<int>():                 %6.1f ns\n", cast);
+  std::printf("old any_cast<int>() checks:      %6.1f ns\n", oldCast);
+  std::printf("get_extra_data<RCP<A> >(p, \"a\"): %6.1f ns\n", extraData);
+  delete oldValue;
+  return 0;
+}
@@ -0,0 +1,86 @@
+// Times a hot loop with two checks that never fire (TEUCHOS_ASSERT_EQUALITY
+// and TEST_FOR_EXCEPTION with a streamed message) against the same loop
+// without the checks, and dereferences an RCP in a loop (which is checked in
+// a debug build).  The code size of the call sites can be compared with
+// "size" on main.cpp.o.
+//
+//   $ ./assert_macros [numIters]
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_Assert.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <sys/time.h>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+namespace {
+
+double wallTime()
+{
+  timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec * 1e9 + tv.tv_usec * 1e3;
+}
+
+double sumChecked(const std::vector<double> &x, int n)
+{
+  double sum = 0.0;
+  for (int i = 0; i < n; ++i) {
+    TEUCHOS_ASSERT_EQUALITY(static_cast<int>(x.size()), n);
+    TEST_FOR_EXCEPTION(x[i] < 0.0, std::out_of_range,
+      "Error, x[" << i << "] = " << x[i] << " < 0!");
+    sum += x[i];
+  }
+  return sum;
+}
+
+double sumUnchecked(const std::vector<double> &x, int n)
+{
+  double sum = 0.0;
+  for (int i = 0; i < n; ++i)
+    sum += x[i];
+  return sum;
+}
+
+double sumRCP(const RCP<std::vector<double> > &x, int n)
+{
+  double sum = 0.0;
+  for (int i = 0; i < n; ++i)
+    sum += (*x)[i];
+  return sum;
+}
+
+volatile double sink = 0.0;
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+  const int numIters = argc > 1 ? std::atoi(argv[1]) : 100;
+  const int n = 100000;
+  const RCP<std::vector<double> > x = rcp(new std::vector<double>(n, 1.0));
+
+  double start = wallTime();
+  for (int k = 0; k < numIters; ++k)
+    sink += sumChecked(*x, n);
+  const double checked = (wallTime() - start) / (double(numIters) * n);
+
+  start = wallTime();
+  for (int k = 0; k < numIters; ++k)
+    sink += sumUnchecked(*x, n);
+  const double unchecked = (wallTime() - start) / (double(numIters) * n);
+
+  start = wallTime();
+  for (int k = 0; k < numIters; ++k)
+    sink += sumRCP(x, n);
+  const double throughRCP = (wallTime() - start) / (double(numIters) * n);
+
+  std::printf("loop with two checks:     %6.2f ns per iteration\n", checked);
+  std::printf("loop without checks:      %6.2f ns per iteration\n", unchecked);
+  std::printf("loop dereferencing an RCP: %5.2f ns per iteration\n",
+    throughRCP);
+  return 0;
+}
@@ -0,0 +1,83 @@
+// Times dyn_cast_ptr() against dynamic_cast for a downcast to the exact
+// type, a failing downcast, a downcast to an intermediate class (which goes
+// through the cache) from one and from several dynamic types, and a cast
+// from a virtual base (which is not cached).
+//
+//   $ ./dyn_cast [numIters]
+
+#include "Teuchos_dyn_cast.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <sys/time.h>
+
+using Teuchos::dyn_cast_ptr;
+
+namespace {
+
+double wallTime()
+{
+  timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec * 1e9 + tv.tv_usec * 1e3;
+}
+
+struct Base { virtual ~Base() {} };
+struct Mid : Base {};
+template<int N> struct Leaf : Mid { int n[N]; };
+struct Other : Base {};
+
+struct VBase { virtual ~VBase() {} };
+struct VMid : virtual VBase {};
+struct VLeaf : VMid {};
+
+volatile long sink = 0;
+
+// Casts objs[i % numObjs] numIters times and returns the time per cast
+template<class T_To, class T_From>
+double timeCasts(T_From *const objs[], int numObjs, int numIters,
+  bool useDynCastPtr)
+{
+  const double start = wallTime();
+  if (useDynCastPtr) {
+    for (int i = 0; i < numIters; ++i)
+      sink += dyn_cast_ptr<T_To>(objs[i % numObjs]) != 0;
+  }
+  else {
+    for (int i = 0; i < numIters; ++i)
+      sink += dynamic_cast<T_To*>(objs[i % numObjs]) != 0;
+  }
+  return (wallTime() - start) / numIters;
+}
+
+template<class T_To, class T_From>
+void run(const char *label, T_From *const objs[], int numObjs, int numIters)
+{
+  const double dynamicCast = timeCasts<T_To>(objs, numObjs, numIters, false);
+  const double dynCastPtr = timeCasts<T_To>(objs, numObjs, numIters, true);
+  std::printf("%-32s dynamic_cast %6.1f ns, dyn_cast_ptr %6.1f ns\n",
+    label, dynamicCast, dynCastPtr);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+  const int numIters = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  Leaf<1> l1; Leaf<2> l2; Leaf<3> l3; Leaf<4> l4; Leaf<5> l5; Leaf<6> l6;
+  Leaf<7> l7; Leaf<8> l8; Leaf<9> l9; Leaf<10> l10; Leaf<11> l11;
+  Leaf<12> l12;
+  Other other;
+  VLeaf vleaf;
+  Base *const leaf[] = { &l1 };
+  Base *const others[] = { &other };
+  Base *const leaves[] = { &l1, &l2, &l3, &l4, &l5, &l6, &l7, &l8, &l9,
+    &l10, &l11, &l12 };
+  VBase *const vleaves[] = { &vleaf };
+  run<Leaf<1> >("exact type", leaf, 1, numIters);
+  run<Leaf<1> >("failing", others, 1, numIters);
+  run<Mid>("intermediate, 1 type", leaf, 1, numIters);
+  run<Mid>("intermediate, 4 types", leaves, 4, numIters);
+  run<Mid>("intermediate, 12 types", leaves, 12, numIters);
+  run<VMid>("from a virtual base", vleaves, 1, numIters);
+  return 0;
+}
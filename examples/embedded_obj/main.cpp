@@ -0,0 +1,68 @@
+// Counts how often an embedded object is copied and moved on its way into
+// the node by rcpWithEmbeddedObj(), for a temporary and for an lvalue, and
+// times rcpWithEmbeddedObj() with an embedded RCP.
+//
+//   $ ./embedded_obj [numIters]
+
+#include "Teuchos_RCP.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <sys/time.h>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+using Teuchos::rcpWithEmbeddedObj;
+
+namespace {
+
+double wallTime()
+{
+  timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec * 1e9 + tv.tv_usec * 1e3;
+}
+
+int numCopies = 0, numMoves = 0;
+
+// An embedded object that counts its copies and moves
+struct Counted {
+  Counted() {}
+  Counted(const Counted &) { ++numCopies; }
+#ifdef HAVE_TEUCHOS_CXX11
+  Counted(Counted &&) { ++numMoves; }
+#endif
+  Counted& operator=(const Counted &) { ++numCopies; return *this; }
+#ifdef HAVE_TEUCHOS_CXX11
+  Counted& operator=(Counted &&) { ++numMoves; return *this; }
+#endif
+};
+
+void report(const char *label)
+{
+  std::printf("%-10s %d copies, %d moves\n", label, numCopies, numMoves);
+  numCopies = numMoves = 0;
+}
+
+volatile int sink = 0;
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+  const int numIters = argc > 1 ? std::atoi(argv[1]) : 1000000;
+
+  rcpWithEmbeddedObj(new int(0), Counted());
+  report("temporary:");
+  const Counted counted;
+  rcpWithEmbeddedObj(new int(0), counted);
+  report("lvalue:");
+
+  const RCP<int> parent = rcp(new int(0));
+  double start = wallTime();
+  for (int i = 0; i < numIters; ++i)
+    sink += rcpWithEmbeddedObj(new int(i), parent).count();
+  const double withRCP = (wallTime() - start) / numIters;
+  std::printf("rcpWithEmbeddedObj(new int, parent) and release: %.1f ns\n",
+    withRCP);
+  return 0;
+}
@@ -0,0 +1,52 @@
+// Times looking up an int attached as extra data to an RCP that also holds
+// a few other named entries, by name and by an ExtraDataKey.
+//
+//   $ ./extra_data [numIters]
+
+#include "Teuchos_RCP.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <sys/time.h>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+using Teuchos::inOutArg;
+
+namespace {
+
+double wallTime()
+{
+  timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec * 1e9 + tv.tv_usec * 1e3;
+}
+
+struct CountKey : Teuchos::ExtraDataKey<int> {};
+
+volatile int sink = 0;
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+  const int numIters = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  RCP<double> p = rcp(new double(0.0));
+  Teuchos::set_extra_data(1.0, "scale", inOutArg(p));
+  Teuchos::set_extra_data(rcp(new int(2)), "owner", inOutArg(p));
+  Teuchos::set_extra_data(3, "count", inOutArg(p));
+  Teuchos::set_extra_data<CountKey>(3, inOutArg(p));
+
+  double start = wallTime();
+  for (int i = 0; i < numIters; ++i)
+    sink += Teuchos::get_extra_data<int>(p, "count");
+  const double named = (wallTime() - start) / numIters;
+
+  start = wallTime();
+  for (int i = 0; i < numIters; ++i)
+    sink += Teuchos::get_extra_data<CountKey>(p);
+  const double keyed = (wallTime() - start) / numIters;
+
+  std::printf("get_extra_data<int>(p, \"count\"): %6.1f ns\n", named);
+  std::printf("get_extra_data<CountKey>(p):      %6.1f ns\n", keyed);
+  return 0;
+}
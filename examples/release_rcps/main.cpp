@@ -0,0 +1,73 @@
+// Times releasing a large vector of RCPs in shuffled order one at a time
+// (vector::clear()) and with releaseRCPs(), with and without grouping the
+// RCPs by node, both for RCPs to distinct objects and for many RCPs that
+// share a few objects.
+//
+//   $ ./release_rcps [numRCPs] [numObjsShared]
+
+#include "Teuchos_RCPBulk.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <sys/time.h>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+namespace {
+
+double wallTime()
+{
+  timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec * 1e3 + tv.tv_usec * 1e-3;
+}
+
+// numRCPs RCPs to numObjs objects, in shuffled order
+void fill(std::vector<RCP<int> > &rcps, int numRCPs, int numObjs)
+{
+  std::vector<RCP<int> > objs;
+  for (int i = 0; i < numObjs; ++i)
+    objs.push_back(rcp(new int(i)));
+  rcps.clear();
+  rcps.reserve(numRCPs);
+  for (int i = 0; i < numRCPs; ++i)
+    rcps.push_back(objs[i % numObjs]);
+  std::srand(1);
+  for (int i = numRCPs - 1; i > 0; --i)
+    std::swap(rcps[i], rcps[std::rand() % (i + 1)]);
+}
+
+void run(const char *label, int numRCPs, int numObjs)
+{
+  std::vector<RCP<int> > rcps;
+  fill(rcps, numRCPs, numObjs);
+  double start = wallTime();
+  rcps.clear();
+  const double oneAtATime = wallTime() - start;
+  fill(rcps, numRCPs, numObjs);
+  start = wallTime();
+  Teuchos::releaseRCPs(rcps);
+  const double grouped = wallTime() - start;
+  fill(rcps, numRCPs, numObjs);
+  start = wallTime();
+  Teuchos::releaseRCPs(rcps, false);
+  const double ungrouped = wallTime() - start;
+  std::printf("%-8s %d RCPs to %d objects:\n"
+    "  clear()                    %8.1f ms\n"
+    "  releaseRCPs()              %8.1f ms\n"
+    "  releaseRCPs(rcps, false)   %8.1f ms\n",
+    label, numRCPs, numObjs, oneAtATime, grouped, ungrouped);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+  const int numRCPs = argc > 1 ? std::atoi(argv[1]) : 2000000;
+  const int numObjsShared = argc > 2 ? std::atoi(argv[2]) : 1000;
+  run("distinct", numRCPs, numRCPs);
+  run("shared", numRCPs, numObjsShared);
+  return 0;
+}
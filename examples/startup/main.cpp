@@ -0,0 +1,48 @@
+// Measures the time spent in static initialization before main() and in
+// static destruction after main() for a program made of many translation
+// units that include Teuchos_RCP.hpp (see CMakeLists.txt).
+
+#include "Teuchos_RCP.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <sys/time.h>
+
+namespace {
+
+double wallTime()
+{
+  timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec * 1e6 + tv.tv_usec;
+}
+
+double startTime = 0.0, mainStartTime = 0.0, mainEndTime = 0.0;
+
+void printExitTime()
+{
+  std::printf("static destruction: %.1f us\n", wallTime() - mainEndTime);
+}
+
+#if defined(__GNUC__)
+// Run before all other static initializers and register printExitTime() so
+// that it runs after all of the other static destructors.
+__attribute__((constructor(101))) void recordStartTime()
+{
+  startTime = wallTime();
+  std::atexit(printExitTime);
+}
+#endif
+
+} // namespace
+
+int main()
+{
+  mainStartTime = wallTime();
+  if (startTime != 0.0)
+    std::printf("static initialization: %.1f us\n", mainStartTime - startTime);
+  else
+    std::printf("static initialization: not measured (needs GCC)\n");
+  Teuchos::RCP<int> p = Teuchos::rcp(new int(0));
+  mainEndTime = wallTime();
+  return *p;
+}
@@ -0,0 +1,70 @@
+// Times TypeNameTraits<T>::name() and typeName(obj) next to demangling the
+// name on every call (what they used to do), and creating and releasing an
+// RCP, which asks for the type name of the object in a debug build.
+//
+//   $ ./type_name [numIters]
+
+#include "Teuchos_RCP.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <sys/time.h>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+namespace {
+
+double wallTime()
+{
+  timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec * 1e9 + tv.tv_usec * 1e3;
+}
+
+struct B { virtual ~B() {} };
+
+struct C : B {};
+
+volatile std::size_t sink = 0;
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+  const int numIters = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  C c;
+  B *volatile obj = &c;
+
+  double start = wallTime();
+  for (int i = 0; i < numIters; ++i)
+    sink += Teuchos::TypeNameTraits<RCP<B> >::name().size();
+  const double name = (wallTime() - start) / numIters;
+
+  start = wallTime();
+  for (int i = 0; i < numIters; ++i)
+    sink += Teuchos::demangleName(typeid(RCP<B>).name()).size();
+  const double demangledName = (wallTime() - start) / numIters;
+
+  start = wallTime();
+  for (int i = 0; i < numIters; ++i)
+    sink += Teuchos::typeName(*obj).size();
+  const double concreteName = (wallTime() - start) / numIters;
+
+  start = wallTime();
+  for (int i = 0; i < numIters; ++i)
+    sink += Teuchos::demangleName(typeid(*obj).name()).size();
+  const double demangledConcreteName = (wallTime() - start) / numIters;
+
+  start = wallTime();
+  for (int i = 0; i < numIters; ++i)
+    sink += rcp(new C).count();
+  const double newRCP = (wallTime() - start) / numIters;
+
+  std::printf("TypeNameTraits<RCP<B> >::name():  %7.1f ns\n", name);
+  std::printf("  demangled on every call:        %7.1f ns\n", demangledName);
+  std::printf("typeName(obj):                    %7.1f ns\n", concreteName);
+  std::printf("  demangled on every call:        %7.1f ns\n",
+    demangledConcreteName);
+  std::printf("rcp(new C) and release:           %7.1f ns\n", newRCP);
+  return 0;
+}
@@ -43,6 +43,26 @@
 #  define HAVE_TEUCHOS_ARRAY_BOUNDSCHECK
 #endif
 
+#if defined(__cplusplus) && __cplusplus >= 201103L
+#  define HAVE_TEUCHOS_CXX11
+#endif
+
+#if defined(__cplusplus) && __cplusplus >= 201703L && defined(__has_include)
+#  if __has_include(<memory_resource>)
+#    define HAVE_TEUCHOS_PMR
+#  endif
+#endif
+
+/* Type names can be extracted from __PRETTY_FUNCTION__ at compile time */
+#if defined(__cplusplus) && __cplusplus >= 201703L \
+  && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9))
+#  define HAVE_TEUCHOS_CONSTEXPR_TYPE_NAME
+#endif
+
+#if defined(HAVE_TEUCHOS_THREAD_SAFE) && !defined(HAVE_TEUCHOS_CXX11)
+#  error "HAVE_TEUCHOS_THREAD_SAFE requires a C++11 compiler (std::atomic)"
+#endif
+
 #ifdef __cplusplus
 
 #if defined(_MSC_VER) || defined(__APPLE__)
@@ -85,6 +105,63 @@
 #include <typeinfo>
 #include <limits>
 #include <memory>
+#ifdef HAVE_TEUCHOS_CXX11
+#  include <utility>
+#endif
+
+// Pass on a by-value argument that is not used again.  It is moved with
+// C++11 and copied otherwise.
+#ifdef HAVE_TEUCHOS_CXX11
+#  define TEUCHOS_MOVE(x) std::move(x)
+#else
+#  define TEUCHOS_MOVE(x) (x)
+#endif
+
+// Exceptions are turned off by the compiler (e.g. -fno-exceptions).  Errors
+// are then reported by TestForException_abort() instead of being thrown (see
+// Teuchos_TestForException.hpp).
+#if !defined(TEUCHOS_NO_EXCEPTIONS) && !defined(__cpp_exceptions) \
+  && !defined(__EXCEPTIONS) && !defined(_CPPUNWIND)
+#  define TEUCHOS_NO_EXCEPTIONS
+#endif
+
+// Cleanup blocks that only exist to undo partial work before an exception
+// is passed on.  Without exceptions the handler block is never entered.
+#ifndef TEUCHOS_NO_EXCEPTIONS
+#  define TEUCHOS_TRY try
+#  define TEUCHOS_CATCH_ALL catch (...)
+#  define TEUCHOS_RETHROW throw
+#else
+#  define TEUCHOS_TRY if (true)
+#  define TEUCHOS_CATCH_ALL if (false)
+#  define TEUCHOS_RETHROW ((void)0)
+#endif
+
+// Function that never returns to its caller
+#if defined(HAVE_TEUCHOS_CXX11)
+#  define TEUCHOS_NORETURN [[noreturn]]
+#elif defined(__GNUC__)
+#  define TEUCHOS_NORETURN __attribute__((noreturn))
+#elif defined(_MSC_VER)
+#  define TEUCHOS_NORETURN __declspec(noreturn)
+#else
+#  define TEUCHOS_NORETURN
+#endif
+
+// Error paths: keep them out of line and out of the way of the hot code
+#if defined(__GNUC__)
+#  define TEUCHOS_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#  define TEUCHOS_NOINLINE __attribute__((noinline))
+#  define TEUCHOS_COLD __attribute__((cold))
+#elif defined(_MSC_VER)
+#  define TEUCHOS_UNLIKELY(x) (x)
+#  define TEUCHOS_NOINLINE __declspec(noinline)
+#  define TEUCHOS_COLD
+#else
+#  define TEUCHOS_UNLIKELY(x) (x)
+#  define TEUCHOS_NOINLINE
+#  define TEUCHOS_COLD
+#endif
 
 namespace Teuchos { class DummyDummyClass; }
 // Above, is used for a dumb reason (see
@@ -0,0 +1,94 @@
+// @HEADER
+// ***********************************************************************
+// 
+//                    Teuchos: Common Tools Package
+//                 Copyright (2004) Sandia Corporation
+// 
+// Under terms of Contract DE-AC04-94AL85000, there is a non-exclusive
+// license for use of this work by or on behalf of the U.S. Government.
+// 
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as
+// published by the Free Software Foundation; either version 2.1 of the
+// License, or (at your option) any later version.
+//  
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//  
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+// Questions? Contact Michael A. Heroux (maherou@sandia.gov) 
+// 
+// ***********************************************************************
+// @HEADER
+
+#ifndef TEUCHOS_CONSTEXPR_TYPE_NAME_HPP
+#define TEUCHOS_CONSTEXPR_TYPE_NAME_HPP
+
+/*! \file Teuchos_ConstexprTypeName.hpp
+    \brief Type names computed at compile time from <tt>__PRETTY_FUNCTION__</tt>.
+*/
+
+#include "Teuchos_ConfigDefs.hpp"
+
+#ifndef HAVE_TEUCHOS_CONSTEXPR_TYPE_NAME
+#  error "Teuchos_ConstexprTypeName.hpp requires C++17 and g++ >= 9 or clang"
+#endif
+
+#include <string_view>
+
+
+namespace Teuchos {
+
+
+namespace ConstexprTypeNamePrivateUtilityPack {
+
+
+template<typename T>
+constexpr std::string_view prettyFunction()
+{
+  return __PRETTY_FUNCTION__;
+}
+
+// The type name is found at the same offsets for every T, so measure them
+// once using a type with a known spelling.
+inline constexpr std::string_view probe = prettyFunction<double>();
+inline constexpr std::size_t prefixLength = probe.find("double");
+inline constexpr std::size_t suffixLength = probe.size() - prefixLength - 6;
+
+static_assert(prefixLength != std::string_view::npos,
+  "Teuchos: could not find the type name in __PRETTY_FUNCTION__");
+
+
+} // namespace ConstexprTypeNamePrivateUtilityPack
+
+
+/** \brief Return the name of the type <tt>T</tt>, computed at compile time.
+ *
+ * The returned view points into the static string of
+ * <tt>__PRETTY_FUNCTION__</tt>, so it stays valid for the whole program and
+ * no demangling is done at runtime.  RTTI is not needed either.
+ *
+ * The spelling is the compiler's.  For example g++ leaves out default
+ * template arguments (<tt>"Teuchos::RCP<A>"</tt>), which
+ * <tt>demangleName()</tt> would include.
+ *
+ * \ingroup teuchos_language_support_grp
+ */
+template<typename T>
+constexpr std::string_view constexprTypeName()
+{
+  using namespace ConstexprTypeNamePrivateUtilityPack;
+  return prettyFunction<T>().substr( prefixLength,
+    prettyFunction<T>().size() - prefixLength - suffixLength );
+}
+
+
+} // namespace Teuchos
+
+
+#endif // TEUCHOS_CONSTEXPR_TYPE_NAME_HPP
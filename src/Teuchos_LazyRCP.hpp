@@ -0,0 +1,195 @@
+// @HEADER
+// ***********************************************************************
+// 
+//                    Teuchos: Common Tools Package
+//                 Copyright (2004) Sandia Corporation
+// 
+// Under terms of Contract DE-AC04-94AL85000, there is a non-exclusive
+// license for use of this work by or on behalf of the U.S. Government.
+// 
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as
+// published by the Free Software Foundation; either version 2.1 of the
+// License, or (at your option) any later version.
+//  
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//  
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+// Questions? Contact Michael A. Heroux (maherou@sandia.gov) 
+// 
+// ***********************************************************************
+// @HEADER
+
+#ifndef TEUCHOS_LAZY_RCP_HPP
+#define TEUCHOS_LAZY_RCP_HPP
+
+
+/** \file Teuchos_LazyRCP.hpp
+ *
+ * \brief Reference-counted object that is created on first use.
+ */
+
+
+#include "Teuchos_RCP.hpp"
+
+#ifndef HAVE_TEUCHOS_CXX11
+#  error "Teuchos_LazyRCP.hpp requires a C++11 compiler"
+#endif
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+
+namespace Teuchos {
+
+
+/** \brief Holds a factory and the <tt>RCP<T></tt> object it creates the
+ * first time the object is accessed.
+ *
+ * This is for expensive objects that are held as class members but are not
+ * used by every program run:
+
+ \code
+  class Service {
+  public:
+    Service()
+      : solver_(std::bind(&Service::createSolver, this))
+      {}
+    void solve() { solver_->solve(); }
+  private:
+    LazyRCP<Solver> solver_;
+    RCP<Solver> createSolver() const { return rcp(new Solver(...)); }
+  };
+ \endcode
+
+ * The factory is called at most once even if several threads access the
+ * object at the same time.  All of the threads get the same object and the
+ * factory is released once it has been called.  Once the object has been
+ * created, every access is just one acquire load plus the access to the
+ * underlying <tt>RCP<T></tt>.
+ *
+ * If the factory throws, the exception propagates out of the accessing
+ * function and the next access calls the factory again.  A factory returning
+ * <tt>null</tt> is accepted and results in a null object.
+ *
+ * A <tt>LazyRCP</tt> can not be copied.  Use <tt>getRCP()</tt> to share the
+ * object.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T>
+class LazyRCP {
+public:
+
+  /** \brief . */
+  typedef std::function<RCP<T>()> factory_t;
+
+  /** \brief Construct with no factory (i.e. a null object). */
+  LazyRCP(ENull null_arg = null)
+    : initialized_(true)
+    {(void)null_arg;}
+
+  /** \brief Construct given the factory.
+   *
+   * The factory is not called here.
+   */
+  explicit LazyRCP(const factory_t &factory)
+    : initialized_(false), factory_(factory)
+    {}
+
+  /** \brief Construct given an already created object. */
+  LazyRCP(const RCP<T> &obj)
+    : initialized_(true), obj_(obj)
+    {}
+
+  /** \brief Return if the object has been created yet. */
+  bool is_initialized() const
+    {
+      return initialized_.load(std::memory_order_acquire);
+    }
+
+  /** \brief Return the object, creating it if needed. */
+  const RCP<T>& getRCP() const
+    {
+      if (!initialized_.load(std::memory_order_acquire))
+        initialize();
+      return obj_;
+    }
+
+  /** \brief Same as <tt>getRCP()</tt>. */
+  operator const RCP<T>&() const
+    {
+      return getRCP();
+    }
+
+  /** \brief Create the object if needed and return if it is null. */
+  bool is_null() const
+    {
+      return getRCP().is_null();
+    }
+
+  /** \brief Create the object if needed and return its address. */
+  T* get() const
+    {
+      return getRCP().get();
+    }
+
+  /** \brief Create the object if needed and access it. */
+  T* operator->() const
+    {
+      return getRCP().operator->();
+    }
+
+  /** \brief Create the object if needed and access it. */
+  T& operator*() const
+    {
+      return *getRCP();
+    }
+
+private:
+
+  mutable std::atomic<bool> initialized_;
+  mutable std::mutex initialize_mutex_;
+  mutable factory_t factory_;
+  mutable RCP<T> obj_;
+
+  void initialize() const
+    {
+      std::lock_guard<std::mutex> lock(initialize_mutex_);
+      if (initialized_.load(std::memory_order_relaxed))
+        return; // Another thread created the object first
+      obj_ = factory_(); // May throw
+      factory_ = factory_t();
+      initialized_.store(true, std::memory_order_release);
+    }
+
+  // Not defined and not to be called
+  LazyRCP(const LazyRCP&);
+  LazyRCP& operator=(const LazyRCP&);
+
+};
+
+
+/** \brief Return a <tt>LazyRCP<T></tt> factory that creates the object
+ * with <tt>new ConcreteT()</tt>.
+ *
+ * \relates LazyRCP
+ */
+template<class T, class ConcreteT>
+typename LazyRCP<T>::factory_t lazyRCPDefaultFactory()
+{
+  return []() { return RCP<T>(rcp(new ConcreteT())); };
+}
+
+
+} // namespace Teuchos
+
+
+#endif // TEUCHOS_LAZY_RCP_HPP
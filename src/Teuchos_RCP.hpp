@@ -54,6 +54,53 @@
 namespace Teuchos {
 
 
+// very bad public functions
+
+
+template<class T>
+inline
+RCPNode* RCP_createNewRCPNodeRawPtrNonowned( T* p )
+{
+  return new typename RCPNodeTmplType<T,DeallocNull<T> >::type(p, DeallocNull<T>(), false);
+}
+
+
+template<class T>
+inline
+RCPNode* RCP_createNewRCPNodeRawPtrNonownedUndefined( T* p )
+{
+  return new typename RCPNodeTmplType<T,DeallocNull<T> >::type(p, DeallocNull<T>(), false, null);
+}
+
+
+template<class T>
+inline
+RCPNode* RCP_createNewRCPNodeRawPtr( T* p, bool has_ownership_in )
+{
+  return new typename RCPNodeTmplType<T,DeallocDelete<T> >::type(p, DeallocDelete<T>(), has_ownership_in);
+}
+
+
+template<class T, class Dealloc_T>
+inline
+RCPNode* RCP_createNewDeallocRCPNodeRawPtr(
+  T* p, Dealloc_T dealloc, bool has_ownership_in
+  )
+{
+  return new typename RCPNodeTmplType<T,Dealloc_T>::type(p, TEUCHOS_MOVE(dealloc), has_ownership_in);
+}
+
+
+template<class T, class Dealloc_T>
+inline
+RCPNode* RCP_createNewDeallocRCPNodeRawPtrUndefined(
+  T* p, Dealloc_T dealloc, bool has_ownership_in
+  )
+{
+  return new typename RCPNodeTmplType<T,Dealloc_T>::type(p, TEUCHOS_MOVE(dealloc), has_ownership_in, null);
+}
+
+
 // Constructors/destructors/initializers
 
 
@@ -139,7 +186,7 @@ inline
 RCP<T>::RCP( T* p, Dealloc_T dealloc, bool has_ownership_in )
   : ptr_(p)
 #ifndef TEUCHOS_DEBUG
-  , node_(RCP_createNewDeallocRCPNodeRawPtr(p, dealloc, has_ownership_in))
+  , node_(RCP_createNewDeallocRCPNodeRawPtr(p, TEUCHOS_MOVE(dealloc), has_ownership_in))
 #endif // TEUCHOS_DEBUG
 {
 #ifdef TEUCHOS_DEBUG
@@ -147,7 +194,7 @@ RCP<T>::RCP( T* p, Dealloc_T dealloc, bool has_ownership_in )
     // Here we are assuming that if the user passed in a custom deallocator
     // then they will want to have ownership (otherwise it will throw if it is
     // the same object).
-    RCPNodeThrowDeleter nodeDeleter(RCP_createNewDeallocRCPNodeRawPtr(p, dealloc, has_ownership_in));
+    RCPNodeThrowDeleter nodeDeleter(RCP_createNewDeallocRCPNodeRawPtr(p, TEUCHOS_MOVE(dealloc), has_ownership_in));
     node_ = RCPNodeHandle(
       nodeDeleter.get(),
       p, typeName(*p), concreteTypeName(*p),
@@ -165,7 +212,7 @@ inline
 RCP<T>::RCP( T* p, Dealloc_T dealloc, ERCPUndefinedWithDealloc, bool has_ownership_in )
   : ptr_(p)
 #ifndef TEUCHOS_DEBUG
-  , node_(RCP_createNewDeallocRCPNodeRawPtrUndefined(p, dealloc, has_ownership_in))
+  , node_(RCP_createNewDeallocRCPNodeRawPtrUndefined(p, TEUCHOS_MOVE(dealloc), has_ownership_in))
 #endif // TEUCHOS_DEBUG
 {
 #ifdef TEUCHOS_DEBUG
@@ -175,7 +222,7 @@ RCP<T>::RCP( T* p, Dealloc_T dealloc, ERCPUndefinedWithDealloc, bool has_ownersh
     // the same object).
     // Use auto_ptr to ensure we don't leak if a throw occurs
     RCPNodeThrowDeleter nodeDeleter(RCP_createNewDeallocRCPNodeRawPtrUndefined(
-      p, dealloc, has_ownership_in));
+      p, TEUCHOS_MOVE(dealloc), has_ownership_in));
     node_ = RCPNodeHandle(
       nodeDeleter.get(),
       p, typeName(*p), concreteTypeName(*p),
@@ -194,6 +241,17 @@ RCP<T>::RCP(const RCP<T>& r_ptr)
 {}
 
 
+#ifdef HAVE_TEUCHOS_CXX11
+template<class T>
+inline
+RCP<T>::RCP(RCP<T>&& r_ptr) noexcept
+  : ptr_(r_ptr.ptr_), node_(std::move(r_ptr.node_))
+{
+  r_ptr.ptr_ = 0;
+}
+#endif // HAVE_TEUCHOS_CXX11
+
+
 template<class T>
 template<class T2>
 inline
@@ -223,6 +281,22 @@ RCP<T>& RCP<T>::operator=(const RCP<T>& r_ptr)
 }
 
 
+#ifdef HAVE_TEUCHOS_CXX11
+template<class T>
+inline
+RCP<T>& RCP<T>::operator=(RCP<T>&& r_ptr)
+{
+#ifdef TEUCHOS_DEBUG
+  if (this == &r_ptr)
+    return *this;
+  reset(); // Force delete first in debug mode!
+#endif
+  RCP<T>(std::move(r_ptr)).swap(*this);
+  return *this;
+}
+#endif // HAVE_TEUCHOS_CXX11
+
+
 template<class T>
 inline
 RCP<T>& RCP<T>::operator=(ENull)
@@ -405,6 +479,17 @@ RCP<T> RCP<T>::create_strong() const
 }
 
 
+template<class T>
+inline
+RCP<T> RCP<T>::create_strong_thread_safe() const
+{
+  RCPNodeHandle strongNode = node_.create_strong_thread_safe();
+  if (strongNode.is_node_null())
+    return null;
+  return RCP<T>(ptr_, strongNode);
+}
+
+
 template<class T>
 template <class T2>
 inline
@@ -473,53 +558,6 @@ int RCP<T>::count() const
 }
 
 
-// very bad public functions
-
-
-template<class T>
-inline
-RCPNode* RCP_createNewRCPNodeRawPtrNonowned( T* p )
-{
-  return new RCPNodeTmpl<T,DeallocNull<T> >(p, DeallocNull<T>(), false);
-}
-
-
-template<class T>
-inline
-RCPNode* RCP_createNewRCPNodeRawPtrNonownedUndefined( T* p )
-{
-  return new RCPNodeTmpl<T,DeallocNull<T> >(p, DeallocNull<T>(), false, null);
-}
-
-
-template<class T>
-inline
-RCPNode* RCP_createNewRCPNodeRawPtr( T* p, bool has_ownership_in )
-{
-  return new RCPNodeTmpl<T,DeallocDelete<T> >(p, DeallocDelete<T>(), has_ownership_in);
-}
-
-
-template<class T, class Dealloc_T>
-inline
-RCPNode* RCP_createNewDeallocRCPNodeRawPtr(
-  T* p, Dealloc_T dealloc, bool has_ownership_in
-  )
-{
-  return new RCPNodeTmpl<T,Dealloc_T>(p, dealloc, has_ownership_in);
-}
-
-
-template<class T, class Dealloc_T>
-inline
-RCPNode* RCP_createNewDeallocRCPNodeRawPtrUndefined(
-  T* p, Dealloc_T dealloc, bool has_ownership_in
-  )
-{
-  return new RCPNodeTmpl<T,Dealloc_T>(p, dealloc, has_ownership_in, null);
-}
-
-
 template<class T>
 inline
 RCP<T>::RCP( T* p, const RCPNodeHandle& node)
@@ -566,7 +604,7 @@ inline
 Teuchos::RCP<T>
 Teuchos::rcpWithDealloc( T* p, Dealloc_T dealloc, bool owns_mem )
 {
-  return RCP<T>(p, dealloc, owns_mem);
+  return RCP<T>(p, TEUCHOS_MOVE(dealloc), owns_mem);
 }
 
 
@@ -575,7 +613,7 @@ inline
 Teuchos::RCP<T>
 Teuchos::rcpWithDeallocUndef( T* p, Dealloc_T dealloc, bool owns_mem )
 {
-  return RCP<T>(p, dealloc, RCP_UNDEFINED_WITH_DEALLOC, owns_mem);
+  return RCP<T>(p, TEUCHOS_MOVE(dealloc), RCP_UNDEFINED_WITH_DEALLOC, owns_mem);
 }
 
 
@@ -595,6 +633,55 @@ Teuchos::rcpFromUndefRef( T& r )
 }
 
 
+template<class T>
+inline
+Teuchos::ScopedRCPFromRef<T>::ScopedRCPFromRef( T& r )
+  : ptr_(&r), node_(&r, DeallocNull<T>(), false)
+#ifdef TEUCHOS_DEBUG
+  , traced_(RCPNodeTracer::isTracingActiveRCPNodes())
+#endif
+{
+  // This is the reference held by the scope itself (see the class docs).
+  node_.incr_count(RCP_STRONG);
+#ifdef TEUCHOS_DEBUG
+  if (traced_) {
+    std::ostringstream os;
+    os << "{T="<<typeName(r)<<", ConcreteT="<<concreteTypeName(r)
+       <<", p="<<static_cast<const void*>(ptr_)
+       <<", has_ownership=0, scoped=1}";
+    RCPNodeTracer::addNewRCPNode(&node_, os.str());
+  }
+#endif
+}
+
+
+template<class T>
+inline
+Teuchos::ScopedRCPFromRef<T>::~ScopedRCPFromRef()
+{
+#ifdef TEUCHOS_DEBUG
+  TEST_FOR_TERMINATION(
+    node_.strong_count() != 1 || node_.weak_count() != 0,
+    "ScopedRCPFromRef<"<<TypeNameTraits<T>::name()<<">::~ScopedRCPFromRef(): "
+    "Error, the scope is being destroyed while "
+    << node_.strong_count()-1 << " strong and " << node_.weak_count()
+    << " weak RCP objects created by getRCP() are still alive and would dangle!\n\n"
+    << RCPNodeTracer::getCommonDebugNotesString() );
+  if (traced_)
+    RCPNodeTracer::removeRCPNode(&node_);
+#endif
+  node_.delete_obj(); // Just clears the pointer, DeallocNull does not free
+}
+
+
+template<class T>
+inline
+Teuchos::RCP<T> Teuchos::ScopedRCPFromRef<T>::getRCP() const
+{
+  return RCP<T>(ptr_, RCPNodeHandle(&node_, RCP_STRONG, false));
+}
+
+
 template<class T, class Embedded>
 Teuchos::RCP<T>
 Teuchos::rcpWithEmbeddedObjPreDestroy(
@@ -625,14 +712,50 @@ Teuchos::rcpWithEmbeddedObj( T* p, const Embedded &embedded, bool owns_mem )
 }
 
 
+#ifdef HAVE_TEUCHOS_CXX11
+
+
+template<class T, class Embedded, class>
+Teuchos::RCP<T>
+Teuchos::rcpWithEmbeddedObjPreDestroy(
+  T* p, Embedded &&embedded, bool owns_mem
+  )
+{
+  return rcp(
+    p, embeddedObjDeallocDelete<T>(std::move(embedded),PRE_DESTROY), owns_mem
+    );
+}
+
+
+template<class T, class Embedded, class>
+Teuchos::RCP<T>
+Teuchos::rcpWithEmbeddedObjPostDestroy(
+  T* p, Embedded &&embedded, bool owns_mem
+  )
+{
+  return rcp( p, embeddedObjDeallocDelete<T>(std::move(embedded),POST_DESTROY), owns_mem );
+}
+
+
+template<class T, class Embedded, class>
+Teuchos::RCP<T>
+Teuchos::rcpWithEmbeddedObj( T* p, Embedded &&embedded, bool owns_mem )
+{
+  return rcpWithEmbeddedObjPostDestroy<T>(p,std::move(embedded),owns_mem);
+}
+
+
+#endif // HAVE_TEUCHOS_CXX11
+
+
 template<class T, class ParentT>
 Teuchos::RCP<T>
 Teuchos::rcpWithInvertedObjOwnership(const RCP<T> &child,
   const RCP<ParentT> &parent)
 {
-  using std::make_pair;
   typedef std::pair<RCP<T>, RCP<ParentT> > Pair_t;
-  return rcpWithEmbeddedObj(child.getRawPtr(), make_pair(child, parent), false);
+  // The pair is a temporary so it is moved (not copied) into the node
+  return rcpWithEmbeddedObj(child.getRawPtr(), Pair_t(child, parent), false);
 }
 
 
@@ -740,7 +863,7 @@ Teuchos::rcp_dynamic_cast(const RCP<T1>& p1, bool throw_on_fail)
     }
     else {
       // Make the compiler check if the conversion is legal
-      p = dynamic_cast<T2*>(p1.get());
+      p = dyn_cast_ptr<T2>(p1.get());
     }
     if (p) {
       return RCP<T2>(p, p1.access_private_node());
@@ -762,6 +885,17 @@ void Teuchos::set_extra_data( const T1 &extra_data, const std::string& name,
 }
 
 
+template<class T>
+inline
+void Teuchos::add_destroy_callback( const RCP<T> &p,
+  RCPNodeDestroyCallback &callback, EPrePostDestruction destroy_when )
+{
+  p.assert_not_null();
+  p.access_private_node().node_ptr()->add_destroy_callback(
+    callback, destroy_when );
+}
+
+
 template<class T1, class T2>
 inline
 const T1& Teuchos::get_extra_data( const RCP<T2>& p, const std::string& name )
@@ -769,7 +903,7 @@ const T1& Teuchos::get_extra_data( const RCP<T2>& p, const std::string& name )
   p.assert_not_null();
   return any_cast<T1>(
     p.access_private_node().get_extra_data(
-      TypeNameTraits<T1>::name(), name
+      typeid(T1), name
       )
     );
 }
@@ -782,7 +916,7 @@ T1& Teuchos::get_nonconst_extra_data( RCP<T2>& p, const std::string& name )
   p.assert_not_null();
   return any_cast<T1>(
     p.nonconst_access_private_node().get_extra_data(
-      TypeNameTraits<T1>::name(), name
+      typeid(T1), name
       )
     );
 }
@@ -795,7 +929,7 @@ Teuchos::get_optional_extra_data( const RCP<T2>& p, const std::string& name )
 {
   p.assert_not_null();
   const any *extra_data = p.access_private_node().get_optional_extra_data(
-    TypeNameTraits<T1>::name(), name);
+    typeid(T1), name);
   if (extra_data)
     return Ptr<const T1>(&any_cast<T1>(*extra_data));
   return null;
@@ -809,13 +943,64 @@ Teuchos::get_optional_nonconst_extra_data( RCP<T2>& p, const std::string& name )
 {
   p.assert_not_null();
   any *extra_data = p.nonconst_access_private_node().get_optional_extra_data(
-    TypeNameTraits<T1>::name(), name);
+    typeid(T1), name);
   if (extra_data)
     return Ptr<T1>(&any_cast<T1>(*extra_data));
   return null;
 }
 
 
+template<class Key, class T>
+inline
+void Teuchos::set_extra_data( const typename Key::value_type &extra_data,
+  const Ptr<RCP<T> > &p, EPrePostDestruction destroy_when )
+{
+  p->assert_not_null();
+  p->access_private_node().node_ptr()->extra_data().template set_key_data<Key>(
+    extra_data, destroy_when);
+}
+
+
+template<class Key, class T>
+inline
+const typename Key::value_type& Teuchos::get_extra_data( const RCP<T>& p )
+{
+  p.assert_not_null();
+  return p.access_private_node().node_ptr()->extra_data().template get_key_data<Key>();
+}
+
+
+template<class Key, class T>
+inline
+typename Key::value_type& Teuchos::get_nonconst_extra_data( RCP<T>& p )
+{
+  p.assert_not_null();
+  return p.access_private_node().node_ptr()->extra_data().template get_key_data<Key>();
+}
+
+
+template<class Key, class T>
+inline
+Teuchos::Ptr<const typename Key::value_type>
+Teuchos::get_optional_extra_data( const RCP<T>& p )
+{
+  p.assert_not_null();
+  return Ptr<const typename Key::value_type>(
+    p.access_private_node().node_ptr()->extra_data().template get_optional_key_data<Key>());
+}
+
+
+template<class Key, class T>
+inline
+Teuchos::Ptr<typename Key::value_type>
+Teuchos::get_optional_nonconst_extra_data( RCP<T>& p )
+{
+  p.assert_not_null();
+  return Ptr<typename Key::value_type>(
+    p.access_private_node().node_ptr()->extra_data().template get_optional_key_data<Key>());
+}
+
+
 template<class Dealloc_T, class T>
 inline
 const Dealloc_T& Teuchos::get_dealloc( const RCP<T>& p )
@@ -0,0 +1,266 @@
+// @HEADER
+// ***********************************************************************
+// 
+//                    Teuchos: Common Tools Package
+//                 Copyright (2004) Sandia Corporation
+// 
+// Under terms of Contract DE-AC04-94AL85000, there is a non-exclusive
+// license for use of this work by or on behalf of the U.S. Government.
+// 
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as
+// published by the Free Software Foundation; either version 2.1 of the
+// License, or (at your option) any later version.
+//  
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//  
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+// Questions? Contact Michael A. Heroux (maherou@sandia.gov) 
+// 
+// ***********************************************************************
+// @HEADER
+
+#ifndef TEUCHOS_RCP_ALLOCATOR_HPP
+#define TEUCHOS_RCP_ALLOCATOR_HPP
+
+
+/** \file Teuchos_RCPAllocator.hpp
+ *
+ * \brief Creation of <tt>RCP</tt> objects whose object and node memory come
+ * from a standard allocator or a <tt>std::pmr::memory_resource</tt>.
+ */
+
+
+#include "Teuchos_RCP.hpp"
+
+#ifndef HAVE_TEUCHOS_CXX11
+#  error "Teuchos_RCPAllocator.hpp requires a C++11 compiler"
+#endif
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#ifdef HAVE_TEUCHOS_PMR
+#  include <memory_resource>
+#endif
+
+
+namespace Teuchos {
+
+
+/** \brief Deallocator class that destroys an object and returns its memory
+ * through a standard allocator.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T, class Alloc>
+class DeallocAllocator
+{
+public:
+  /// Gives the type (required)
+  typedef T ptr_t;
+  /** \brief . */
+  typedef typename std::allocator_traits<Alloc>::template rebind_alloc<T> alloc_t;
+  /** \brief . */
+  explicit DeallocAllocator( const Alloc &alloc )
+    : alloc_(alloc)
+    {}
+  /// Destroys <tt>*ptr</tt> and deallocates its memory (required).
+  void free( T* ptr )
+    {
+      if (ptr) {
+        std::allocator_traits<alloc_t>::destroy(alloc_, ptr);
+        std::allocator_traits<alloc_t>::deallocate(alloc_, ptr, 1);
+      }
+    }
+private:
+  alloc_t alloc_;
+};
+
+
+/** \brief Node class for objects created with <tt>rcpWithAllocator()</tt>.
+ *
+ * The node itself lives in memory from the same allocator.  A copy of the
+ * allocator is kept in a header just in front of the node so that the
+ * memory can be given back after the node has been destroyed.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T, class Alloc>
+class RCPAllocatorNodeTmpl
+  : public RCPNodeTmpl<T, DeallocAllocator<T,Alloc> >
+{
+public:
+  /** \brief . */
+  typedef DeallocAllocator<T,Alloc> dealloc_t;
+
+  /** \brief Allocate and construct the node for the owned object
+   * <tt>p</tt>. */
+  static RCPNode* create(T* p, const Alloc &alloc)
+    {
+      static_assert(sizeof(RCPAllocatorNodeTmpl) == sizeof(RCPNodeTmpl<T,dealloc_t>)
+        && alignof(RCPAllocatorNodeTmpl) <= alignof(unit_t),
+        "RCPAllocatorNodeTmpl does not fit its block");
+      block_alloc_t blockAlloc(alloc);
+      unit_t *block = block_traits::allocate(blockAlloc, num_units);
+      char *raw = reinterpret_cast<char*>(block);
+      new (raw) block_alloc_t(blockAlloc);
+      TEUCHOS_TRY {
+        return new (raw + header_size) RCPAllocatorNodeTmpl(p, dealloc_t(alloc));
+      }
+      TEUCHOS_CATCH_ALL {
+        reinterpret_cast<block_alloc_t*>(raw)->~block_alloc_t();
+        block_traits::deallocate(blockAlloc, block, num_units);
+        TEUCHOS_RETHROW;
+      }
+    }
+
+  /** \brief Give the node memory back to the allocator it came from. */
+  static void operator delete(void* p)
+    {
+      char *raw = static_cast<char*>(p) - header_size;
+      block_alloc_t *header = reinterpret_cast<block_alloc_t*>(raw);
+      block_alloc_t blockAlloc(std::move(*header));
+      header->~block_alloc_t();
+      block_traits::deallocate(blockAlloc, reinterpret_cast<unit_t*>(raw),
+        num_units);
+    }
+  /** \brief Only used by <tt>create()</tt>. */
+  static void* operator new(std::size_t, void* p)
+    {
+      return p;
+    }
+  /** \brief . */
+  static void operator delete(void*, void*)
+    {}
+
+#ifdef TEUCHOS_DEBUG
+  /** \brief . */
+  std::size_t get_node_size() const
+    {
+      return sizeof(*this);
+    }
+#endif
+
+private:
+
+  typedef std::max_align_t unit_t;
+  typedef typename std::allocator_traits<Alloc>::template rebind_alloc<unit_t>
+    block_alloc_t;
+  typedef std::allocator_traits<block_alloc_t> block_traits;
+
+  static const std::size_t header_size =
+    (sizeof(block_alloc_t) + sizeof(unit_t) - 1) / sizeof(unit_t) * sizeof(unit_t);
+  static const std::size_t num_units =
+    (header_size + sizeof(RCPNodeTmpl<T,dealloc_t>) + sizeof(unit_t) - 1)
+    / sizeof(unit_t);
+
+  RCPAllocatorNodeTmpl(T* p, const dealloc_t &dealloc)
+    : RCPNodeTmpl<T,dealloc_t>(p, dealloc, true)
+    {}
+
+  // Not defined and not to be called
+  RCPAllocatorNodeTmpl();
+  RCPAllocatorNodeTmpl(const RCPAllocatorNodeTmpl&);
+  RCPAllocatorNodeTmpl& operator=(const RCPAllocatorNodeTmpl&);
+
+};
+
+
+/** \brief Create an <tt>RCP</tt> to a new object of type <tt>T</tt> where
+ * both the object and its node are allocated using <tt>alloc</tt>.
+ *
+ * This is like <tt>std::allocate_shared()</tt>:
+
+ \code
+  ArenaAllocator<char> arena(...);
+  RCP<Foo> foo = rcpWithAllocator<Foo>(arena, arg1, arg2);
+ \endcode
+
+ * <tt>alloc</tt> is rebound to <tt>T</tt> to allocate and construct the
+ * object, and the object is destroyed and deallocated through a copy of it
+ * once the last strong reference goes away.  The node memory is given back
+ * when the last weak reference goes away.  The allocator (and whatever it
+ * allocates from) must outlive all of the <tt>RCP</tt> objects.
+ *
+ * \relates RCP
+ */
+template<class T, class Alloc, class... Args>
+RCP<T> rcpWithAllocator( const Alloc &alloc, Args&&... args )
+{
+  typedef typename std::allocator_traits<Alloc>::template rebind_alloc<T> obj_alloc_t;
+  typedef std::allocator_traits<obj_alloc_t> obj_traits;
+  obj_alloc_t objAlloc(alloc);
+  T *p = obj_traits::allocate(objAlloc, 1);
+  RCPNode *node = 0;
+  TEUCHOS_TRY {
+    obj_traits::construct(objAlloc, p, std::forward<Args>(args)...);
+  }
+  TEUCHOS_CATCH_ALL {
+    obj_traits::deallocate(objAlloc, p, 1);
+    TEUCHOS_RETHROW;
+  }
+  TEUCHOS_TRY {
+    node = RCPAllocatorNodeTmpl<T,Alloc>::create(p, alloc);
+  }
+  TEUCHOS_CATCH_ALL {
+    obj_traits::destroy(objAlloc, p);
+    obj_traits::deallocate(objAlloc, p, 1);
+    TEUCHOS_RETHROW;
+  }
+#ifdef TEUCHOS_DEBUG
+  RCPNodeThrowDeleter nodeDeleter(node);
+  RCPNodeHandle nodeHandle(node, p, typeName(*p), concreteTypeName(*p), true);
+  nodeDeleter.release();
+  return RCP<T>(p, nodeHandle);
+#else
+  return RCP<T>(p, RCPNodeHandle(node));
+#endif
+}
+
+
+#ifdef HAVE_TEUCHOS_PMR
+
+
+/** \brief Create an <tt>RCP</tt> to a new object of type <tt>T</tt> where
+ * both the object and its node are allocated from the memory resource
+ * <tt>mr</tt>.
+ *
+ * This is <tt>rcpWithAllocator()</tt> with a
+ * <tt>std::pmr::polymorphic_allocator</tt>.  The object is created with
+ * uses-allocator construction so that <tt>std::pmr</tt> containers inside
+ * of it allocate from <tt>mr</tt> as well.  For example, to put everything
+ * for one request into one buffer that is dropped all at once:
+
+ \code
+  std::pmr::monotonic_buffer_resource requestArena;
+  RCP<Request> req = rcpWithMemoryResource<Request>(&requestArena, ...);
+ \endcode
+
+ * <tt>*mr</tt> must outlive all of the <tt>RCP</tt> objects.
+ *
+ * \relates RCP
+ */
+template<class T, class... Args>
+RCP<T> rcpWithMemoryResource( std::pmr::memory_resource* mr, Args&&... args )
+{
+  return rcpWithAllocator<T>(std::pmr::polymorphic_allocator<T>(mr),
+    std::forward<Args>(args)...);
+}
+
+
+#endif // HAVE_TEUCHOS_PMR
+
+
+} // namespace Teuchos
+
+
+#endif // TEUCHOS_RCP_ALLOCATOR_HPP
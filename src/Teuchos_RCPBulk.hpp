@@ -0,0 +1,446 @@
+// @HEADER
+// ***********************************************************************
+// 
+//                    Teuchos: Common Tools Package
+//                 Copyright (2004) Sandia Corporation
+// 
+// Under terms of Contract DE-AC04-94AL85000, there is a non-exclusive
+// license for use of this work by or on behalf of the U.S. Government.
+// 
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as
+// published by the Free Software Foundation; either version 2.1 of the
+// License, or (at your option) any later version.
+//  
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//  
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+// Questions? Contact Michael A. Heroux (maherou@sandia.gov) 
+// 
+// ***********************************************************************
+// @HEADER
+
+#ifndef TEUCHOS_RCP_BULK_HPP
+#define TEUCHOS_RCP_BULK_HPP
+
+
+/** \file Teuchos_RCPBulk.hpp
+ *
+ * \brief Creation of many <tt>RCP</tt>-managed objects of the same type
+ * with one allocation and release of many <tt>RCP</tt>s at once.
+ */
+
+
+#include "Teuchos_RCP.hpp"
+
+#ifndef HAVE_TEUCHOS_CXX11
+#  error "Teuchos_RCPBulk.hpp requires a C++11 compiler"
+#endif
+
+#include <cstddef>
+#include <new>
+#include <vector>
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+#  include <atomic>
+#endif
+
+
+namespace Teuchos {
+
+
+/** \brief Deallocator class that destroys an object in place without
+ * freeing its memory.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T>
+class DeallocDestroyInPlace
+{
+public:
+  /// Gives the type (required)
+  typedef T ptr_t;
+  /// Calls <tt>ptr->~T()</tt> (required).
+  void free( T* ptr ) { if (ptr) ptr->~T(); }
+};
+
+
+/** \brief Deallocator class that destroys an array of objects in place
+ * without freeing its memory.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T>
+class DeallocArrayDestroyInPlace
+{
+public:
+  /// Gives the type (required)
+  typedef T ptr_t;
+  /** \brief . */
+  explicit DeallocArrayDestroyInPlace( std::size_t size )
+    : size_(size)
+    {}
+  /// Calls <tt>~T()</tt> for <tt>ptr[size-1]</tt> down to <tt>ptr[0]</tt>
+  /// (required).
+  void free( T* ptr )
+    {
+      if (ptr) {
+        for (std::size_t i = size_; i > 0; --i)
+          ptr[i-1].~T();
+      }
+    }
+private:
+  std::size_t size_;
+};
+
+
+namespace RCPBulkUtils {
+
+
+// Block of objects and nodes created by rcpBulk().  Laid out as
+//
+//   [Block][T objects...][NodeSlot...]
+//
+// where each NodeSlot is a pointer back to the Block followed by the node.
+// The block is freed when the last of its nodes has been deleted.
+struct Block {
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  std::atomic<std::size_t> numLiveNodes;
+#else
+  std::size_t numLiveNodes;
+#endif
+};
+
+
+inline std::size_t roundUp( std::size_t size, std::size_t align )
+{
+  return (size + align - 1) / align * align;
+}
+
+
+} // namespace RCPBulkUtils
+
+
+/** \brief Node class for objects created with <tt>rcpBulk()</tt>.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T>
+class RCPBulkNodeTmpl : public RCPNodeTmpl<T, DeallocDestroyInPlace<T> > {
+public:
+  /** \brief . */
+  explicit RCPBulkNodeTmpl( T* p )
+    : RCPNodeTmpl<T, DeallocDestroyInPlace<T> >(p, DeallocDestroyInPlace<T>(), true)
+    {}
+#ifdef TEUCHOS_DEBUG
+  /** \brief . */
+  std::size_t get_node_size() const
+    {
+      return sizeof(*this);
+    }
+#endif
+  /** \brief Offset of the node in its slot. */
+  static std::size_t node_offset()
+    {
+      return RCPBulkUtils::roundUp(sizeof(RCPBulkUtils::Block*),
+        alignof(RCPBulkNodeTmpl));
+    }
+  /** \brief Alignment of a node slot. */
+  static std::size_t slot_align()
+    {
+      return alignof(RCPBulkNodeTmpl) > alignof(RCPBulkUtils::Block*)
+        ? alignof(RCPBulkNodeTmpl) : alignof(RCPBulkUtils::Block*);
+    }
+  /** \brief Size of a node slot. */
+  static std::size_t slot_size()
+    {
+      return RCPBulkUtils::roundUp(node_offset() + sizeof(RCPBulkNodeTmpl),
+        slot_align());
+    }
+  /** \brief Only used by <tt>rcpBulk()</tt>. */
+  static void* operator new(std::size_t, void* p)
+    {
+      return p;
+    }
+  /** \brief Free the block once its last node is gone. */
+  static void operator delete(void* p)
+    {
+      RCPBulkUtils::Block *block =
+        *reinterpret_cast<RCPBulkUtils::Block**>(static_cast<char*>(p) - node_offset());
+      if (--block->numLiveNodes == 0) {
+        block->~Block();
+        ::operator delete(block);
+      }
+    }
+  /** \brief . */
+  static void operator delete(void*, void*)
+    {}
+private:
+  // Not defined and not to be called
+  RCPBulkNodeTmpl();
+  RCPBulkNodeTmpl(const RCPBulkNodeTmpl&);
+  RCPBulkNodeTmpl& operator=(const RCPBulkNodeTmpl&);
+};
+
+
+/** \brief Node class for the objects created with
+ * <tt>rcpBulkShared()</tt>.
+ *
+ * The node sits at the beginning of the block that also holds the
+ * objects.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T>
+class RCPBulkSharedNodeTmpl
+  : public RCPNodeTmpl<T, DeallocArrayDestroyInPlace<T> >
+{
+public:
+  /** \brief . */
+  RCPBulkSharedNodeTmpl( T* p, std::size_t size )
+    : RCPNodeTmpl<T, DeallocArrayDestroyInPlace<T> >(
+        p, DeallocArrayDestroyInPlace<T>(size), true)
+    {}
+#ifdef TEUCHOS_DEBUG
+  /** \brief . */
+  std::size_t get_node_size() const
+    {
+      return sizeof(*this);
+    }
+#endif
+  /** \brief Offset of the first object in the block. */
+  static std::size_t objs_offset()
+    {
+      return RCPBulkUtils::roundUp(sizeof(RCPBulkSharedNodeTmpl), alignof(T));
+    }
+  /** \brief Only used by <tt>rcpBulkShared()</tt>. */
+  static void* operator new(std::size_t, void* p)
+    {
+      return p;
+    }
+  /** \brief Frees the whole block. */
+  static void operator delete(void* p)
+    {
+      ::operator delete(p);
+    }
+  /** \brief . */
+  static void operator delete(void*, void*)
+    {}
+private:
+  // Not defined and not to be called
+  RCPBulkSharedNodeTmpl();
+  RCPBulkSharedNodeTmpl(const RCPBulkSharedNodeTmpl&);
+  RCPBulkSharedNodeTmpl& operator=(const RCPBulkSharedNodeTmpl&);
+};
+
+
+namespace RCPBulkUtils {
+
+
+// Construct objs[0..n-1] from args, destroying the ones already created if
+// a constructor throws.
+template<class T, class... Args>
+void constructObjs( T* objs, std::size_t n, const Args&... args )
+{
+  std::size_t i = 0;
+  TEUCHOS_TRY {
+    for ( ; i < n; ++i)
+      new (objs + i) T(args...);
+  }
+  TEUCHOS_CATCH_ALL {
+    for ( ; i > 0; --i)
+      objs[i-1].~T();
+    TEUCHOS_RETHROW;
+  }
+}
+
+
+template<class T>
+RCP<T> createRCP( T* p, RCPNode* node )
+{
+#ifdef TEUCHOS_DEBUG
+  return RCP<T>(p, RCPNodeHandle(node, p, typeName(*p), concreteTypeName(*p), true));
+#else
+  return RCP<T>(p, RCPNodeHandle(node));
+#endif
+}
+
+
+// Create the objects and nodes for one block of rcpBulk()
+template<class T, class... Args>
+void createBlock( std::vector<RCP<T> > &rcps, std::size_t n, const Args&... args )
+{
+  typedef RCPBulkNodeTmpl<T> node_t;
+  const std::size_t objsOffset = roundUp(sizeof(Block), alignof(T));
+  const std::size_t slotsOffset =
+    roundUp(objsOffset + n * sizeof(T), node_t::slot_align());
+  const std::size_t slotSize = node_t::slot_size();
+  char *raw = static_cast<char*>(::operator new(slotsOffset + n * slotSize));
+  Block *block = new (raw) Block;
+  T *objs = reinterpret_cast<T*>(raw + objsOffset);
+  TEUCHOS_TRY {
+    constructObjs(objs, n, args...);
+  }
+  TEUCHOS_CATCH_ALL {
+    block->~Block();
+    ::operator delete(raw);
+    TEUCHOS_RETHROW;
+  }
+  block->numLiveNodes = n;
+  for (std::size_t i = 0; i < n; ++i) {
+    char *slot = raw + slotsOffset + i * slotSize;
+    *reinterpret_cast<Block**>(slot) = block;
+    rcps.push_back(createRCP(objs + i,
+        new (slot + node_t::node_offset()) node_t(objs + i)));
+  }
+}
+
+
+} // namespace RCPBulkUtils
+
+
+/** \brief Create <tt>n</tt> objects of type <tt>T</tt> at once, each with
+ * its own <tt>RCP</tt>.
+ *
+ * Every object is constructed as <tt>T(args...)</tt>.  The objects are
+ * created in blocks of <tt>blockSize</tt> objects (all of them in one block
+ * if <tt>blockSize</tt> is <tt>0</tt>).  Each block takes just one
+ * allocation which holds the objects next to each other followed by their
+ * <tt>RCPNode</tt>s next to each other:
+
+ \code
+  std::vector<RCP<Point> > points = rcpBulk<Point>(numPoints, 4096, 0.0, 0.0);
+ \endcode
+
+ * The objects have independent lifetimes as if each were created with
+ * <tt>rcp(new T(args...))</tt>: an object is destroyed when its last strong
+ * <tt>RCP</tt> goes away.  The memory of a block is freed once the nodes of
+ * all of its objects are gone.
+ *
+ * If a constructor throws, the objects already created are destroyed and
+ * all of the memory is freed.
+ *
+ * \relates RCP
+ */
+template<class T, class... Args>
+std::vector<RCP<T> > rcpBulk( std::size_t n, std::size_t blockSize,
+  const Args&... args )
+{
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+    "rcpBulk() does not support over-aligned types");
+  if (blockSize == 0)
+    blockSize = n;
+  std::vector<RCP<T> > rcps;
+  rcps.reserve(n);
+  for (std::size_t i = 0; i < n; i += blockSize)
+    RCPBulkUtils::createBlock(rcps, n - i < blockSize ? n - i : blockSize, args...);
+  return rcps;
+}
+
+
+/** \brief Create <tt>n</tt> objects of type <tt>T</tt> that share one
+ * <tt>RCPNode</tt>.
+ *
+ * This is for the common case where all of the objects die together.  The
+ * node and all of the objects are in one allocation and all of the returned
+ * <tt>RCP</tt>s share the node's reference count.  None of the objects is
+ * destroyed before all of the <tt>RCP</tt>s (including copies and casts)
+ * are gone.
+ *
+ * \relates RCP
+ */
+template<class T, class... Args>
+std::vector<RCP<T> > rcpBulkShared( std::size_t n, const Args&... args )
+{
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+    "rcpBulkShared() does not support over-aligned types");
+  typedef RCPBulkSharedNodeTmpl<T> node_t;
+  std::vector<RCP<T> > rcps;
+  if (n == 0)
+    return rcps;
+  rcps.reserve(n);
+  char *raw = static_cast<char*>(::operator new(node_t::objs_offset() + n * sizeof(T)));
+  T *objs = reinterpret_cast<T*>(raw + node_t::objs_offset());
+  TEUCHOS_TRY {
+    RCPBulkUtils::constructObjs(objs, n, args...);
+  }
+  TEUCHOS_CATCH_ALL {
+    ::operator delete(raw);
+    TEUCHOS_RETHROW;
+  }
+  const RCP<T> first = RCPBulkUtils::createRCP(objs, new (raw) node_t(objs, n));
+  rcps.push_back(first);
+  for (std::size_t i = 1; i < n; ++i)
+    rcps.push_back(RCP<T>(objs + i, first.access_private_node()));
+  return rcps;
+}
+
+
+/** \brief Release all of the <tt>RCP</tt>s in <tt>[first,last)</tt> at
+ * once and make them null.
+ *
+ * References to the same node are dropped with one count update (after
+ * sorting by node if <tt>groupByNode==true</tt>) and the objects and nodes
+ * that go away are deleted together at the end (see
+ * <tt>RCPNodeHandle::unbind_all()</tt>).  This pays off in a debug build
+ * with node tracing when many nodes go away, since the nodes are then
+ * removed from the tracing list in address order.  Otherwise the sorting
+ * costs more than it saves and releasing the <tt>RCP</tt>s one at a time
+ * is as fast or faster (see the <tt>release_rcps</tt> example).
+ *
+ * If deleting an object throws, the <tt>RCP</tt>s that were not released
+ * yet are left as they were.
+ *
+ * \relates RCP
+ */
+template<class Iter>
+void releaseRCPs( Iter first, Iter last, bool groupByNode = true )
+{
+  std::vector<RCPNodeHandle*> handles;
+  for (Iter itr = first; itr != last; ++itr) {
+    if (!itr->access_private_node().is_node_null())
+      handles.push_back(&itr->nonconst_access_private_node());
+  }
+  if (handles.empty())
+    return;
+  TEUCHOS_TRY {
+    RCPNodeHandle::unbind_all(&handles[0], handles.size(), groupByNode);
+  }
+  TEUCHOS_CATCH_ALL {
+    for (Iter itr = first; itr != last; ++itr) {
+      if (itr->access_private_node().is_node_null())
+        *itr = null;
+    }
+    TEUCHOS_RETHROW;
+  }
+  for (Iter itr = first; itr != last; ++itr)
+    *itr = null;
+}
+
+
+/** \brief Release all of the <tt>RCP</tt>s in a vector at once and clear
+ * it.
+ *
+ * \relates RCP
+ */
+template<class T>
+void releaseRCPs( std::vector<RCP<T> > &rcps, bool groupByNode = true )
+{
+  releaseRCPs(rcps.begin(), rcps.end(), groupByNode);
+  rcps.clear();
+}
+
+
+} // namespace Teuchos
+
+
+#endif // TEUCHOS_RCP_BULK_HPP
@@ -36,8 +36,12 @@
 
 
 #include "Teuchos_RCPNode.hpp"
+#include "Teuchos_RCPPolicyTraits.hpp"
 #include "Teuchos_ENull.hpp"
 #include "Teuchos_NullIteratorTraits.hpp"
+#ifdef HAVE_TEUCHOS_CXX11
+#  include <type_traits>
+#endif
 
 
 #ifdef REFCOUNTPTR_INLINE_FUNCS
@@ -64,6 +68,16 @@ enum ERCPUndefinedWeakNoDealloc { RCP_UNDEFINED_WEAK_NO_DEALLOC };
 enum ERCPUndefinedWithDealloc { RCP_UNDEFINED_WITH_DEALLOC };
 
 
+/** \brief Smart reference counting pointer class templated on a policy.
+ *
+ * The general template for a <tt>Policy</tt> other than
+ * <tt>RCPDefaultPolicy</tt> is defined in
+ * <tt>Teuchos_RCPPolicyDecl.hpp</tt>.  <tt>RCP<T></tt> is the fully featured
+ * specialization for <tt>RCPDefaultPolicy</tt> documented below.
+ */
+template<class T, class Policy = RCPDefaultPolicy> class RCP;
+
+
 /** \brief Smart reference counting pointer class for automatic garbage
   collection.
   
@@ -408,11 +422,22 @@ if (!is_null(b1))
 
 </ol>
 
+<b>Compile-time policies</b>
+
+<tt>RCP<T></tt> is really <tt>RCP<T,RCPDefaultPolicy></tt>.  Objects that
+do not need weak references, extra data, node tracing or thread-safe counting
+can use a leaner node by selecting another policy (see <tt>RCPPolicy</tt>
+and <tt>Teuchos_RCPPolicyDecl.hpp</tt>):
+
+\code
+RCP<C,RCPLeanPolicy> c_ptr = rcpWithPolicy<RCPLeanPolicy>(new C);
+\endcode
+
 \ingroup teuchos_mem_mng_grp
 
  */
 template<class T>
-class RCP {
+class RCP<T, RCPDefaultPolicy> {
 public:
 
   /** \brief . */
@@ -509,6 +534,18 @@ public:
    */
   inline RCP(const RCP<T>& r_ptr);
 
+#ifdef HAVE_TEUCHOS_CXX11
+  /** \brief Move constructor: takes over the reference held by
+   * <tt>r_ptr</tt> without changing the reference count.
+   *
+   * <b>Postconditons:</b><ul>
+   * <li> <tt>this->get()</tt> is the old value of <tt>r_ptr.get()</tt>
+   * <li> <tt>r_ptr.is_null() == true</tt>
+   * </ul>
+   */
+  inline RCP(RCP<T>&& r_ptr) noexcept;
+#endif
+
   /** \brief Initialize from another <tt>RCP<T2></tt> object (implicit conversion only).
    *
    * This function allows the implicit conversion of smart pointer objects just
@@ -559,6 +596,13 @@ public:
    */
   inline RCP<T>& operator=(const RCP<T>& r_ptr);
 
+#ifdef HAVE_TEUCHOS_CXX11
+  /** \brief Move assignment: releases the current reference and takes
+   * over the one held by <tt>r_ptr</tt>, leaving <tt>r_ptr</tt> null.
+   */
+  inline RCP<T>& operator=(RCP<T>&& r_ptr);
+#endif
+
   /** \brief Assign to null.
    *
    * If <tt>this->has_ownership() == true</tt> and <tt>this->strong_count() == 1</tt>
@@ -768,6 +812,22 @@ public:
    */
   inline RCP<T> create_strong() const;
 
+  /** \brief Create a new strong RCP object from another (weak) RCP object
+   * only if the underlying object has not been deleted yet.
+   *
+   * Unlike <tt>create_strong()</tt>, this returns <tt>null</tt> if the strong
+   * count has already gone to zero.  The check and the increment are done in
+   * one step so this is safe to call while another thread may be releasing
+   * the last strong reference (when Teuchos is configured with
+   * <tt>TEUCHOS_ENABLE_THREAD_SAFE=ON</tt>).
+   *
+   * <b>Postconditons:</b> <ul>
+   * <li> <tt>is_null(returnVal) || returnVal.get() == this->get()</tt>
+   * <li> <tt>is_null(returnVal) || returnVal.strength() == RCP_STRONG</tt>
+   * </ul>
+   */
+  inline RCP<T> create_strong_thread_safe() const;
+
   /** \brief Returns true if the smart pointers share the same underlying
    * reference-counted object.
    *
@@ -935,6 +995,61 @@ public:
 };
 
 
+#ifdef HAVE_TEUCHOS_CXX11
+
+
+/** \brief Node class for the non-owning RCPs created by
+ * <tt>rcpFromRef()</tt> and <tt>rcpFromUndefRef()</tt>.
+ *
+ * The node memory is recycled through <tt>RCPNodeBlockCache</tt> (shared by
+ * all <tt>T</tt>) so wrapping a reference in an RCP does not call the heap
+ * allocator once the calling thread has a block cached.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T>
+class RCPNodeTmplNonowned : public RCPNodeTmpl<T,DeallocNull<T> > {
+public:
+  /** \brief For defined types. */
+  RCPNodeTmplNonowned(T* p, DeallocNull<T> dealloc, bool has_ownership_in)
+    : RCPNodeTmpl<T,DeallocNull<T> >(p, dealloc, has_ownership_in)
+    {}
+  /** \brief For undefined types . */
+  RCPNodeTmplNonowned(T* p, DeallocNull<T> dealloc, bool has_ownership_in,
+    ENull null_arg)
+    : RCPNodeTmpl<T,DeallocNull<T> >(p, dealloc, has_ownership_in, null_arg)
+    {}
+  /** \brief . */
+  static void* operator new(std::size_t size)
+    {
+      TEUCHOS_ASSERT_EQUALITY(size, sizeof(RCPNodeTmplNonowned));
+      return RCPNodeBlockCache<sizeof(RCPNodeTmplNonowned)>::allocate();
+    }
+  /** \brief . */
+  static void operator delete(void* p)
+    { RCPNodeBlockCache<sizeof(RCPNodeTmplNonowned)>::deallocate(p); }
+private:
+  // Not defined and not to be called
+  RCPNodeTmplNonowned();
+  RCPNodeTmplNonowned(const RCPNodeTmplNonowned&);
+  RCPNodeTmplNonowned& operator=(const RCPNodeTmplNonowned&);
+};
+
+
+/** \brief . */
+template<class T>
+class RCPNodeTmplType<T, DeallocNull<T>, false> {
+public:
+  /** \brief . */
+  typedef RCPNodeTmplNonowned<T> type;
+};
+
+
+#endif // HAVE_TEUCHOS_CXX11
+
+
 /** \brief Policy class for deallocator that uses <tt>delete</tt> to delete a
  * pointer which is used by <tt>RCP</tt>.
  *
@@ -1047,7 +1162,8 @@ deallocFunctorHandleDelete( DeleteHandleFunctor deleteHandleFunctor )
  * to another deallocator object.
  *
  * The type <tt>Embedded</tt> must be a true value object with a default
- * constructor, a copy constructor, and an assignment operator.
+ * constructor, a copy constructor, and an assignment operator.  With C++11 a
+ * temporary embedded object is moved in instead of copied.
  *
  * \ingroup teuchos_mem_mng_grp
  */
@@ -1059,8 +1175,17 @@ public:
   EmbeddedObjDealloc(
     const Embedded &embedded, EPrePostDestruction prePostDestroy,
     Dealloc dealloc
-    ) : embedded_(embedded), prePostDestroy_(prePostDestroy), dealloc_(dealloc)
+    ) : embedded_(embedded), prePostDestroy_(prePostDestroy),
+        dealloc_(TEUCHOS_MOVE(dealloc))
     {}
+#ifdef HAVE_TEUCHOS_CXX11
+  EmbeddedObjDealloc(
+    Embedded &&embedded, EPrePostDestruction prePostDestroy,
+    Dealloc dealloc
+    ) : embedded_(std::move(embedded)), prePostDestroy_(prePostDestroy),
+        dealloc_(std::move(dealloc))
+    {}
+#endif
   void setObj( const Embedded &embedded ) { embedded_ = embedded; }
   const Embedded& getObj() const { return embedded_; }
   Embedded& getNonconstObj() { return embedded_; }
@@ -1093,6 +1218,23 @@ embeddedObjDeallocDelete(const Embedded &embedded, EPrePostDestruction prePostDe
 }
 
 
+#ifdef HAVE_TEUCHOS_CXX11
+/** \brief Create a dealocator using delete that takes over the temporary
+ * <tt>embedded</tt>.
+ *
+ * \relates EmbeddedObjDealloc
+ */
+template<class T, class Embedded,
+  class = typename std::enable_if<!std::is_lvalue_reference<Embedded>::value>::type>
+EmbeddedObjDealloc<T,typename std::decay<Embedded>::type,DeallocDelete<T> >
+embeddedObjDeallocDelete(Embedded &&embedded, EPrePostDestruction prePostDestroy)
+{
+  return EmbeddedObjDealloc<T,typename std::decay<Embedded>::type,DeallocDelete<T> >(
+    std::move(embedded), prePostDestroy, DeallocDelete<T>());
+}
+#endif
+
+
 /** \brief Create a dealocator with an embedded object using delete [].
  *
  * \relates EmbeddedObjDealloc
@@ -1106,6 +1248,23 @@ embeddedObjDeallocArrayDelete(const Embedded &embedded, EPrePostDestruction preP
 }
 
 
+#ifdef HAVE_TEUCHOS_CXX11
+/** \brief Create a dealocator using delete [] that takes over the temporary
+ * <tt>embedded</tt>.
+ *
+ * \relates EmbeddedObjDealloc
+ */
+template<class T, class Embedded,
+  class = typename std::enable_if<!std::is_lvalue_reference<Embedded>::value>::type>
+EmbeddedObjDealloc<T,typename std::decay<Embedded>::type,DeallocArrayDelete<T> >
+embeddedObjDeallocArrayDelete(Embedded &&embedded, EPrePostDestruction prePostDestroy)
+{
+  return EmbeddedObjDealloc<T,typename std::decay<Embedded>::type,DeallocArrayDelete<T> >(
+    std::move(embedded), prePostDestroy, DeallocArrayDelete<T>());
+}
+#endif
+
+
 /** \brief Create a <tt>RCP</tt> object properly typed.
  *
  * \param p [in] Pointer to an object to be reference counted.
@@ -1183,7 +1342,7 @@ RCP<T> rcpWithDealloc(T* p, Dealloc_T dealloc, bool owns_mem=true);
 template<class T, class Dealloc_T> inline
 RCP<T> rcp( T* p, Dealloc_T dealloc, bool owns_mem )
 {
-  return rcpWithDealloc(p, dealloc, owns_mem);
+  return rcpWithDealloc(p, TEUCHOS_MOVE(dealloc), owns_mem);
 }
 
 
@@ -1209,6 +1368,11 @@ RCP<T> rcpWithDeallocUndef(T* p, Dealloc_T dealloc, bool owns_mem=true);
  * If the type is undefined, then the function <tt>rcpFromUndefRef()</tt>
  * should be called instead.
  *
+ * NOTE: Each call creates a new <tt>RCPNode</tt> object.  With C++11 its
+ * memory comes from a per-thread cache (see <tt>RCPNodeTmplNonowned</tt>) so
+ * this does not go to the heap allocator in a loop.  Use
+ * <tt>ScopedRCPFromRef</tt> to avoid creating the node at all.
+ *
  * \relates RCP
  */
 template<class T> inline
@@ -1228,6 +1392,62 @@ template<class T> inline
 RCP<T> rcpFromUndefRef(T& r);
 
 
+/** \brief Scoped, allocation-free source of non-owning RCP objects to an
+ * object whose lifetime is managed by the enclosing scope.
+ *
+ * <tt>rcpFromRef()</tt> allocates a new <tt>RCPNode</tt> on every call just to
+ * wrap an object that it does not own.  This class instead embeds a single
+ * non-owning node in itself (typically on the stack) and hands out RCP
+ * objects that all share that node:
+
+ \code
+
+ void foo(const RCP<A> &a);
+
+ for (...) {
+   A a;
+   ScopedRCPFromRef<A> a_scope(a);
+   foo(a_scope.getRCP()); // No new/delete
+ }
+
+ \endcode
+
+ * The scope object holds one strong reference of its own for its whole
+ * lifetime so the RCP objects handed out never drive the count to zero and
+ * never try to delete the node.
+ *
+ * <b>Preconditions of the destructor:</b><ul>
+ * <li> All of the RCP objects returned from <tt>getRCP()</tt> (and any
+ *      copies made from them) have been destroyed.  This is asserted in a
+ *      debug build (i.e. <tt>TEUCHOS_DEBUG</tt> defined), where the error is
+ *      reported and the program aborted, but not checked in a release build
+ *      where a surviving RCP object will dangle.
+ * </ul>
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T>
+class ScopedRCPFromRef {
+public:
+  /** \brief . */
+  inline explicit ScopedRCPFromRef(T& r);
+  /** \brief . */
+  inline ~ScopedRCPFromRef();
+  /** \brief Return a non-owning RCP object sharing the embedded node. */
+  inline RCP<T> getRCP() const;
+private:
+  T *ptr_;
+  mutable RCPNodeTmpl<T,DeallocNull<T> > node_;
+#ifdef TEUCHOS_DEBUG
+  bool traced_; // The node was added to the active node list
+#endif
+  // Not defined and not to be called
+  ScopedRCPFromRef();
+  ScopedRCPFromRef(const ScopedRCPFromRef&);
+  ScopedRCPFromRef& operator=(const ScopedRCPFromRef&);
+};
+
+
 /* \brief Create an RCP with and also put in an embedded object.
  *
  * In this case the embedded object is destroyed (by setting to Embedded())
@@ -1274,6 +1494,46 @@ RCP<T>
 rcpWithEmbeddedObj( T* p, const Embedded &embedded, bool owns_mem = true );
 
 
+#ifdef HAVE_TEUCHOS_CXX11
+
+/* \brief Same as <tt>rcpWithEmbeddedObjPreDestroy(T*, const Embedded&,
+ * bool)</tt> but moves the temporary <tt>embedded</tt> into the node instead
+ * of copying it.
+ *
+ * \relates RCP
+ */
+template<class T, class Embedded,
+  class = typename std::enable_if<!std::is_lvalue_reference<Embedded>::value>::type> inline
+RCP<T>
+rcpWithEmbeddedObjPreDestroy( T* p, Embedded &&embedded, bool owns_mem = true );
+
+
+/* \brief Same as <tt>rcpWithEmbeddedObjPostDestroy(T*, const Embedded&,
+ * bool)</tt> but moves the temporary <tt>embedded</tt> into the node instead
+ * of copying it.
+ *
+ * \relates RCP
+ */
+template<class T, class Embedded,
+  class = typename std::enable_if<!std::is_lvalue_reference<Embedded>::value>::type> inline
+RCP<T>
+rcpWithEmbeddedObjPostDestroy( T* p, Embedded &&embedded, bool owns_mem = true );
+
+
+/* \brief Same as <tt>rcpWithEmbeddedObj(T*, const Embedded&, bool)</tt>
+ * but moves the temporary <tt>embedded</tt> into the node instead of copying
+ * it.
+ *
+ * \relates RCP
+ */
+template<class T, class Embedded,
+  class = typename std::enable_if<!std::is_lvalue_reference<Embedded>::value>::type> inline
+RCP<T>
+rcpWithEmbeddedObj( T* p, Embedded &&embedded, bool owns_mem = true );
+
+#endif // HAVE_TEUCHOS_CXX11
+
+
 // 2007/10/25: rabartl: ToDo: put in versions of
 // rcpWithEmbedded[Pre,Post]DestoryWithDealloc(...) that also accept a general
 // deallocator!
@@ -1488,6 +1748,33 @@ void set_extra_data( const T1 &extra_data, const std::string& name,
   const Ptr<RCP<T2> > &p, EPrePostDestruction destroy_when = POST_DESTROY,
   bool force_unique = true);
 
+
+/** \brief Register a callback that is called when the object referenced by
+ * <tt>p</tt> is deleted.
+ *
+ * \param p [in] Smart pointer to the object being observed.
+ *
+ * \param callback [in/out] The callback object.  The client keeps ownership
+ * of it and it is unregistered automatically when it is destroyed.
+ *
+ * \param destroy_when [in] If <tt>PRE_DESTROY</tt>, then the callback is
+ * called right before the object is deleted, otherwise right after it.
+ *
+ * This is much cheaper than observing an object through extra data or by
+ * polling <tt>is_valid_ptr()</tt> on weak RCPs.  See
+ * <tt>RCPNodeDestroyCallback</tt> for details.
+ *
+ * <b>Preconditions:</b><ul>
+ * <li> <tt>p.get() != NULL</tt> (throws <tt>NullReferenceError</tt>)
+ * <li> <tt>!callback.is_registered()</tt> (throws <tt>std::logic_error</tt>)
+ * </ul>
+ *
+ * \relates RCP
+ */
+template<class T>
+void add_destroy_callback( const RCP<T> &p, RCPNodeDestroyCallback &callback,
+  EPrePostDestruction destroy_when = POST_DESTROY );
+
 /** \brief Get a const reference to extra data associated with a <tt>RCP</tt> object.
  *
  * \param p [in] Smart pointer object that extra data is being extraced from.
@@ -1590,6 +1877,74 @@ template<class T1, class T2>
 Ptr<T1> get_optional_nonconst_extra_data( RCP<T2>& p, const std::string& name );
 
 
+/** \brief Set statically typed extra data under the key <tt>Key</tt> (see
+ * <tt>ExtraDataKey</tt>).
+ *
+ * \param extra_data [in] The data that is copied into the node.
+ *
+ * \param p [out] On output, will be updated with the input
+ * <tt>extra_data</tt>.
+ *
+ * \param destroy_when [in] Same meaning as for the named version of
+ * <tt>set_extra_data()</tt>.
+ *
+ * Calling this function again with the same <tt>Key</tt> resets the data.
+ * The data is accessed in constant time with <tt>get_extra_data<Key>(p)</tt>
+ * and friends without any name lookup or <tt>any_cast</tt>.
+ *
+ * <b>Preconditions:</b><ul>
+ * <li> <tt>p->get() != NULL</tt> (throws <tt>NullReferenceError</tt>)
+ * </ul>
+ *
+ * \relates RCP
+ */
+template<class Key, class T>
+void set_extra_data( const typename Key::value_type &extra_data,
+  const Ptr<RCP<T> > &p, EPrePostDestruction destroy_when = POST_DESTROY );
+
+
+/** \brief Get a const reference to the extra data set under the key
+ * <tt>Key</tt>.
+ *
+ * <b>Preconditions:</b><ul>
+ * <li> <tt>p.get() != NULL</tt> (throws <tt>NullReferenceError</tt>)
+ * <li> <tt>set_extra_data<Key>()</tt> must have been called for <tt>p</tt>
+ *      (throws <tt>std::invalid_argument</tt> in a debug build).
+ * </ul>
+ *
+ * \relates RCP
+ */
+template<class Key, class T>
+const typename Key::value_type& get_extra_data( const RCP<T>& p );
+
+
+/** \brief Get a non-const reference to the extra data set under the key
+ * <tt>Key</tt>.
+ *
+ * \relates RCP
+ */
+template<class Key, class T>
+typename Key::value_type& get_nonconst_extra_data( RCP<T>& p );
+
+
+/** \brief Get a pointer to the const extra data set under the key
+ * <tt>Key</tt> (or <tt>null</tt> if it is not set).
+ *
+ * \relates RCP
+ */
+template<class Key, class T>
+Ptr<const typename Key::value_type> get_optional_extra_data( const RCP<T>& p );
+
+
+/** \brief Get a pointer to the non-const extra data set under the key
+ * <tt>Key</tt> (or <tt>null</tt> if it is not set).
+ *
+ * \relates RCP
+ */
+template<class Key, class T>
+Ptr<typename Key::value_type> get_optional_nonconst_extra_data( RCP<T>& p );
+
+
 /** \brief Return a <tt>const</tt> reference to the underlying deallocator
  * object.
  *
@@ -29,6 +29,17 @@
 #include "Teuchos_RCPNode.hpp"
 #include "Teuchos_TestForException.hpp"
 #include "Teuchos_Exceptions.hpp"
+#include <cstdlib>
+#include <cctype>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include <set>
+#include <vector>
+
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+#  include <mutex>
+#endif
 
 
 // Defined this to see tracing of RCPNodes created and destroyed
@@ -49,12 +60,14 @@ namespace {
 
 
 struct RCPNodeInfo {
-  RCPNodeInfo() : nodePtr(0) {}
-  RCPNodeInfo(const std::string &info_in, Teuchos::RCPNode* nodePtr_in)
-    : info(info_in), nodePtr(nodePtr_in)
+  RCPNodeInfo() : nodePtr(0), insertionNumber(-1) {}
+  RCPNodeInfo(const std::string &info_in, Teuchos::RCPNode* nodePtr_in,
+    int insertionNumber_in)
+    : info(info_in), nodePtr(nodePtr_in), insertionNumber(insertionNumber_in)
     {}
   std::string info;
-  Teuchos::RCPNode* nodePtr;
+  Teuchos::RCPNode* nodePtr; // 0 for the node of an RCP<T,Policy> object
+  int insertionNumber;
 };
 
 
@@ -71,7 +84,7 @@ public:
     ) const
     {
 #ifdef TEUCHOS_DEBUG
-      return v1.second.nodePtr->insertion_number() < v2.second.nodePtr->insertion_number();
+      return v1.second.insertionNumber < v2.second.insertionNumber;
 #else
       return v1.first < v2.first;
 #endif
@@ -98,18 +111,122 @@ public:
 
 rcp_node_list_t*& rcp_node_list()
 {
-  static rcp_node_list_t *s_rcp_node_list = 0;
-  // Here we must let the ActiveRCPNodesSetup constructor and destructor handle
-  // the creation and destruction of this map object.  This will ensure that
-  // this map object will be valid when any global/static RCP objects are
-  // destroyed!  Note that this object will get created and destroyed
-  // reguardless if whether we are tracing RCPNodes or not.  This just makes our
-  // life simpler.  NOTE: This list will always get allocated no mater if
-  // TEUCHOS_DEBUG is defined or node traceing is enabled or not.
+  // This map object is created on first use and is never deleted so that it
+  // is still valid when any global/static RCP objects are destroyed, no
+  // matter in what order that happens (see rcp_node_list_mutex()).  The
+  // ActiveRCPNodesSetup object only prints what is left in it at the end of
+  // the program.
+  static rcp_node_list_t *s_rcp_node_list = new rcp_node_list_t;
   return s_rcp_node_list;
 }
 
 
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+std::recursive_mutex& rcp_node_list_mutex()
+{
+  // Never deleted so that it is still valid when static RCP objects are
+  // destroyed.
+  static std::recursive_mutex *s_rcp_node_list_mutex = new std::recursive_mutex;
+  return *s_rcp_node_list_mutex;
+}
+#endif
+
+
+// Locks the RCPNode list in a thread-safe build (does nothing otherwise).
+class RCPNodeListLock {
+public:
+  RCPNodeListLock()
+    {
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      rcp_node_list_mutex().lock();
+#endif
+    }
+  ~RCPNodeListLock()
+    {
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      rcp_node_list_mutex().unlock();
+#endif
+    }
+private:
+  RCPNodeListLock(const RCPNodeListLock&);
+  RCPNodeListLock& operator=(const RCPNodeListLock&);
+};
+
+
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+std::mutex& destroy_callbacks_mutex()
+{
+  // Never deleted (see rcp_node_list_mutex())
+  static std::mutex *s_destroy_callbacks_mutex = new std::mutex;
+  return *s_destroy_callbacks_mutex;
+}
+#endif
+
+
+// Locks all of the RCPNode destroy callback lists in a thread-safe build
+// (does nothing otherwise).  Registration is rare compared to reference
+// counting so one lock is enough.
+class DestroyCallbacksLock {
+public:
+  DestroyCallbacksLock()
+    {
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      destroy_callbacks_mutex().lock();
+#endif
+    }
+  ~DestroyCallbacksLock()
+    {
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      destroy_callbacks_mutex().unlock();
+#endif
+    }
+private:
+  DestroyCallbacksLock(const DestroyCallbacksLock&);
+  DestroyCallbacksLock& operator=(const DestroyCallbacksLock&);
+};
+
+
+// The interned names of the extra data (see RCPNodeExtraData::intern_name())
+std::set<std::string>& extra_data_names()
+{
+  // Never deleted (see rcp_node_list())
+  static std::set<std::string> *s_extra_data_names = new std::set<std::string>;
+  return *s_extra_data_names;
+}
+
+
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+std::mutex& extra_data_names_mutex()
+{
+  // Never deleted (see rcp_node_list_mutex())
+  static std::mutex *s_extra_data_names_mutex = new std::mutex;
+  return *s_extra_data_names_mutex;
+}
+#endif
+
+
+// Locks the interned extra data names in a thread-safe build (does nothing
+// otherwise).
+class ExtraDataNamesLock {
+public:
+  ExtraDataNamesLock()
+    {
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      extra_data_names_mutex().lock();
+#endif
+    }
+  ~ExtraDataNamesLock()
+    {
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      extra_data_names_mutex().unlock();
+#endif
+    }
+private:
+  ExtraDataNamesLock(const ExtraDataNamesLock&);
+  ExtraDataNamesLock& operator=(const ExtraDataNamesLock&);
+};
+
+
 bool& loc_isTracingActiveRCPNodes()
 {
   static bool s_loc_isTracingActiveRCPNodes =
@@ -137,6 +254,105 @@ bool& loc_printRCPNodeStatisticsOnExit()
 }
 
 
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+typedef std::atomic<bool> fast_exit_flag_t;
+#else
+typedef bool fast_exit_flag_t;
+#endif
+
+
+fast_exit_flag_t& loc_fastExit()
+{
+  static fast_exit_flag_t s_loc_fastExit(false);
+  return s_loc_fastExit;
+}
+
+
+// Never deleted so that it can be used during exit
+std::vector<void (*)()>& loc_fastExitFinalizers()
+{
+  static std::vector<void (*)()> *s_loc_fastExitFinalizers =
+    new std::vector<void (*)()>;
+  return *s_loc_fastExitFinalizers;
+}
+
+
+void loc_fastExitHandler()
+{
+  if (!loc_fastExit() || Teuchos::isRCPFastExitInProgress())
+    return;
+  std::vector<void (*)()> &finalizers = loc_fastExitFinalizers();
+  while (!finalizers.empty()) {
+    void (*finalizer)() = finalizers.back();
+    finalizers.pop_back();
+    finalizer();
+  }
+  std::cout << std::flush;
+  std::cerr << std::flush;
+  std::clog << std::flush;
+  Teuchos::RCPFastExitState::set_in_progress();
+}
+
+
+void loc_printFastExitSummary()
+{
+  if (!Teuchos::RCPNodeTracer::isTracingActiveRCPNodes())
+    return;
+  const int numActiveNodes = Teuchos::RCPNodeTracer::numActiveRCPNodes();
+  if (numActiveNodes) {
+    std::cerr << "\nRCPNodeTracer: Fast exit with " << numActiveNodes
+              << " active RCPNode object(s) not deleted.\n" << std::flush;
+  }
+}
+
+
+bool loc_envFastExit()
+{
+  const char *value = std::getenv("TEUCHOS_RCP_FAST_EXIT");
+  if (!value)
+    return false;
+  std::string upperValue(value);
+  for (std::size_t i = 0; i < upperValue.size(); ++i)
+    upperValue[i] = static_cast<char>(std::toupper(upperValue[i]));
+  return upperValue == "1" || upperValue == "ON" || upperValue == "TRUE"
+    || upperValue == "YES";
+}
+
+
+// Turns on fast-exit mode when the library is loaded if asked to by the
+// environment
+class FastExitEnvSetup {
+public:
+  FastExitEnvSetup()
+    {
+      if (loc_envFastExit())
+        Teuchos::setRCPFastExit(true);
+    }
+};
+
+
+FastExitEnvSetup fastExitEnvSetup;
+
+
+// Used to allow unique identification of RCPNode objects to allow setting
+// breakpoints.
+int& loc_insertionNumber()
+{
+  static int s_loc_insertionNumber = 0;
+  return s_loc_insertionNumber;
+}
+
+
+void loc_updateRCPNodeStatisticsOnAdd()
+{
+  ++loc_insertionNumber();
+  ++loc_rcpNodeStatistics().totalNumRCPNodeAllocations;
+  loc_rcpNodeStatistics().maxNumRCPNodes =
+    TEUCHOS_MAX(loc_rcpNodeStatistics().maxNumRCPNodes,
+      Teuchos::RCPNodeTracer::numActiveRCPNodes());
+}
+
+
 //
 // Other helper functions
 //
@@ -186,45 +402,165 @@ std::string convertRCPNodeToString(const Teuchos::RCPNode* rcp_node)
 namespace Teuchos {
 
 
+//
+// RCPNodeDestroyCallback
+//
+
+
+bool RCPNodeDestroyCallback::is_registered() const
+{
+  DestroyCallbacksLock lock;
+  return node_ != 0;
+}
+
+
+bool RCPNodeDestroyCallback::unregister()
+{
+  DestroyCallbacksLock lock;
+  if (!node_)
+    return false;
+  if (prev_)
+    prev_->next_ = next_;
+  else
+    node_->destroy_callbacks_ = next_;
+  if (next_)
+    next_->prev_ = prev_;
+  node_ = 0;
+  prev_ = 0;
+  next_ = 0;
+  return true;
+}
+
+
 //
 // RCPNode
 //
 
 
-void RCPNode::set_extra_data(
+void RCPNode::add_destroy_callback( RCPNodeDestroyCallback &callback,
+  EPrePostDestruction destroy_when )
+{
+  DestroyCallbacksLock lock;
+  TEST_FOR_EXCEPTION( callback.node_ != 0, std::logic_error,
+    "RCPNode::add_destroy_callback(...): Error, the callback is already"
+    " registered!" );
+  RCPNodeDestroyCallback *head = destroy_callbacks_;
+  callback.node_ = this;
+  callback.prev_ = 0;
+  callback.next_ = head;
+  callback.destroy_when_ = destroy_when;
+  if (head)
+    head->prev_ = &callback;
+  destroy_callbacks_ = &callback;
+}
+
+
+void RCPNode::impl_call_destroy_callbacks( EPrePostDestruction destroy_when )
+{
+  while (true) {
+    RCPNodeDestroyCallback *callback = 0;
+    {
+      // Unlink the next matching callback and call it without holding the
+      // lock so that it can (un)register callbacks or delete itself.
+      DestroyCallbacksLock lock;
+      callback = destroy_callbacks_;
+      while (callback && callback->destroy_when_ != destroy_when)
+        callback = callback->next_;
+      if (!callback)
+        return;
+      if (callback->prev_)
+        callback->prev_->next_ = callback->next_;
+      else
+        destroy_callbacks_ = callback->next_;
+      if (callback->next_)
+        callback->next_->prev_ = callback->prev_;
+      callback->node_ = 0;
+      callback->prev_ = 0;
+      callback->next_ = 0;
+    }
+    callback->on_destroy(destroy_when);
+  }
+}
+
+
+void RCPNode::unlink_destroy_callbacks()
+{
+  DestroyCallbacksLock lock;
+  RCPNodeDestroyCallback *callback = destroy_callbacks_;
+  while (callback) {
+    RCPNodeDestroyCallback *next = callback->next_;
+    callback->node_ = 0;
+    callback->prev_ = 0;
+    callback->next_ = 0;
+    callback = next;
+  }
+  destroy_callbacks_ = 0;
+}
+
+
+//
+// RCPNodeExtraData
+//
+
+
+void RCPNodeExtraData::set_extra_data(
   const any &extra_data, const std::string& name
   ,EPrePostDestruction destroy_when
   ,bool force_unique
   )
 {
-  if(extra_data_map_==NULL) {
-    extra_data_map_ = new extra_data_map_t;
-  }
-  const std::string type_and_name( extra_data.typeName() + std::string(":") + name );
-  extra_data_map_t::iterator itr = extra_data_map_->find(type_and_name);
+  any extra_data_copy(extra_data);
+  impl_set_extra_data(extra_data_copy, name, destroy_when, force_unique);
+}
+
+
+#ifdef HAVE_TEUCHOS_CXX11
+void RCPNodeExtraData::set_extra_data(
+  any &&extra_data, const std::string& name
+  ,EPrePostDestruction destroy_when
+  ,bool force_unique
+  )
+{
+  impl_set_extra_data(extra_data, name, destroy_when, force_unique);
+}
+#endif
+
+
+any& RCPNodeExtraData::get_extra_data( const std::type_info& type,
+  const std::string& name )
+{
 #ifdef TEUCHOS_DEBUG
   TEST_FOR_EXCEPTION(
-    (itr != extra_data_map_->end() && force_unique), std::invalid_argument
-    ,"Error, the type:name pair \'" << type_and_name
-    << "\' already exists and force_unique==true!" );
+    extra_data_==NULL, std::invalid_argument
+    ,"Error, no extra data has been set yet!" );
 #endif
-  if (itr != extra_data_map_->end()) {
-    // Change existing extra data
-    itr->second = extra_data_entry_t(extra_data,destroy_when);
-  }
-  else {
-    // Insert new extra data
-    (*extra_data_map_)[type_and_name] =
-      extra_data_entry_t(extra_data,destroy_when);
+  any *extra_data = get_optional_extra_data(type,name);
+#ifdef TEUCHOS_DEBUG
+  if (!extra_data) {
+    TEST_FOR_EXCEPTION(
+      extra_data == NULL, std::invalid_argument
+      ,"Error, the type:name pair \'" << demangleName(type.name()) << ":"
+      << name << "\' is not found!" );
   }
+#endif
+  return *extra_data;
+}
+
+
+any* RCPNodeExtraData::get_optional_extra_data( const std::type_info& type,
+  const std::string& name )
+{
+  extra_data_entry_t *entry = find_entry(type, name);
+  return entry ? &entry->extra_data : NULL;
 }
 
 
-any& RCPNode::get_extra_data( const std::string& type_name, const std::string& name )
+any& RCPNodeExtraData::get_extra_data( const std::string& type_name,
+  const std::string& name )
 {
 #ifdef TEUCHOS_DEBUG
   TEST_FOR_EXCEPTION(
-    extra_data_map_==NULL, std::invalid_argument
+    extra_data_==NULL, std::invalid_argument
     ,"Error, no extra data has been set yet!" );
 #endif
   any *extra_data = get_optional_extra_data(type_name,name);
@@ -240,30 +576,146 @@ any& RCPNode::get_extra_data( const std::string& type_name, const std::string& n
 }
 
 
-any* RCPNode::get_optional_extra_data( const std::string& type_name,
+any* RCPNodeExtraData::get_optional_extra_data( const std::string& type_name,
   const std::string& name )
 {
-  if( extra_data_map_ == NULL ) return NULL;
-  const std::string type_and_name( type_name + std::string(":") + name );
-  extra_data_map_t::iterator itr = extra_data_map_->find(type_and_name);
-  if(itr != extra_data_map_->end())
-    return &(*itr).second.extra_data;
+  if( extra_data_ == NULL ) return NULL;
+  for (extra_data_block_t *b = &extra_data_->entries; b; b = b->next) {
+    for (int i = 0; i < b->numEntries; ++i) {
+      extra_data_entry_t &entry = b->entries[i];
+      if (*entry.name == name && entry.extra_data.typeName() == type_name)
+        return &entry.extra_data;
+    }
+  }
   return NULL;
 }
 
 
-void RCPNode::impl_pre_delete_extra_data()
+const std::string* RCPNodeExtraData::intern_name( const std::string& name )
 {
-  for(
-    extra_data_map_t::iterator itr = extra_data_map_->begin();
-    itr != extra_data_map_->end();
-    ++itr
-    )
-  {
-    extra_data_map_t::value_type &entry = *itr;
-    if(entry.second.destroy_when == PRE_DESTROY)
-      entry.second.extra_data = any();
+  ExtraDataNamesLock lock;
+  return &*extra_data_names().insert(name).first;
+}
+
+
+std::size_t RCPNodeExtraData::hash_name( const std::string& name )
+{
+  // FNV-1a
+  std::size_t hash = 2166136261u;
+  for (std::string::const_iterator itr = name.begin(); itr != name.end(); ++itr) {
+    hash ^= static_cast<unsigned char>(*itr);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+
+RCPNodeExtraData::extra_data_entry_t*
+RCPNodeExtraData::find_entry( const std::type_info& type,
+  const std::string& name )
+{
+  if( extra_data_ == NULL ) return NULL;
+  const std::size_t name_hash = hash_name(name);
+  for (extra_data_block_t *b = &extra_data_->entries; b; b = b->next) {
+    for (int i = 0; i < b->numEntries; ++i) {
+      if (b->entries[i].matches(type, name_hash, name))
+        return &b->entries[i];
+    }
+  }
+  return NULL;
+}
+
+
+void RCPNodeExtraData::impl_set_extra_data(
+  any &extra_data, const std::string& name
+  ,EPrePostDestruction destroy_when
+  ,bool force_unique
+  )
+{
+  if(extra_data_==NULL) {
+    extra_data_ = new extra_data_t;
+  }
+  extra_data_entry_t *entry = find_entry(extra_data.type(), name);
+#ifdef TEUCHOS_DEBUG
+  TEST_FOR_EXCEPTION(
+    (entry && force_unique), std::invalid_argument
+    ,"Error, the type:name pair \'" << extra_data.typeName() << ":" << name
+    << "\' already exists and force_unique==true!" );
+#endif
+  if (!entry) {
+    // Insert new extra data in the first free entry at the end (the entries
+    // before it never move)
+    extra_data_block_t *b = &extra_data_->entries;
+    while (b->next)
+      b = b->next;
+    if (b->numEntries == numEntriesPerBlock) {
+      b->next = new extra_data_block_t;
+      b = b->next;
+    }
+    entry = &b->entries[b->numEntries];
+    entry->type = &extra_data.type();
+    entry->name = intern_name(name);
+    entry->name_hash = hash_name(name);
+    ++b->numEntries;
+  }
+  // Set or change the extra data (the old data goes away with extra_data)
+  entry->extra_data.swap(extra_data);
+  entry->destroy_when = destroy_when;
+  extra_data = any();
+}
+
+
+RCPNodeExtraData::key_data_base_t*&
+RCPNodeExtraData::key_data_slot( int slot )
+{
+  if(extra_data_==NULL) {
+    extra_data_ = new extra_data_t;
   }
+  keyed_array_t &keyed = extra_data_->keyed;
+  if (static_cast<int>(keyed.size()) <= slot)
+    keyed.resize(slot + 1, 0);
+  return keyed[slot];
+}
+
+
+int RCPNodeExtraData::allocate_key_slot()
+{
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  static std::atomic<int> numKeySlots(0);
+#else
+  static int numKeySlots = 0;
+#endif
+  return numKeySlots++;
+}
+
+
+void RCPNodeExtraData::impl_pre_delete_extra_data()
+{
+  for (extra_data_block_t *b = &extra_data_->entries; b; b = b->next) {
+    for (int i = 0; i < b->numEntries; ++i) {
+      if(b->entries[i].destroy_when == PRE_DESTROY)
+        b->entries[i].extra_data = any();
+    }
+  }
+  keyed_array_t &keyed = extra_data_->keyed;
+  for (std::size_t i = 0; i < keyed.size(); ++i) {
+    if(keyed[i] && keyed[i]->destroy_when == PRE_DESTROY) {
+      key_data_base_t *data = keyed[i];
+      keyed[i] = 0;
+      delete data;
+    }
+  }
+}
+
+
+void RCPNodeExtraData::impl_delete_extra_data()
+{
+  typedef keyed_array_t::iterator key_itr_t;
+  for (key_itr_t itr = extra_data_->keyed.begin(); itr != extra_data_->keyed.end(); ++itr) {
+    delete *itr;
+  }
+  delete extra_data_;
+  extra_data_ = 0;
 }
 
 
@@ -291,6 +743,7 @@ void RCPNodeTracer::setTracingActiveRCPNodes(bool tracingActiveNodes)
 
 int RCPNodeTracer::numActiveRCPNodes()
 {
+  RCPNodeListLock lock;
   // This list always exists, no matter debug or not so just access it.
   TEST_FOR_EXCEPT(0==rcp_node_list());
   return rcp_node_list()->size();
@@ -333,6 +786,7 @@ bool RCPNodeTracer::getPrintRCPNodeStatisticsOnExit()
 
 void RCPNodeTracer::printActiveRCPNodes(std::ostream &out)
 {
+  RCPNodeListLock lock;
 #ifdef TEUCHOS_SHOW_ACTIVE_REFCOUNTPTR_NODE_TRACE
   out
     << "\nCalled printActiveRCPNodes() :"
@@ -354,15 +808,17 @@ void RCPNodeTracer::printActiveRCPNodes(std::ostream &out)
       int i = 0;
       for ( itr_t itr = rcp_node_vec.begin(); itr != rcp_node_vec.end(); ++itr ) {
         const rcp_node_list_t::value_type &entry = *itr;
-        TEUCHOS_ASSERT(entry.second.nodePtr);
+        const void *nodeAddress = entry.second.nodePtr;
+        if (!nodeAddress)
+          nodeAddress = entry.first; // An RCP<T,Policy> node is its own key
         out
           << "\n"
           << std::setw(3) << std::right << i << std::left
           << ": RCPNode (map_key_void_ptr=" << entry.first << ")\n"
           << "       Information = " << entry.second.info << "\n"
-          << "       RCPNode address = " << entry.second.nodePtr << "\n"
+          << "       RCPNode address = " << nodeAddress << "\n"
 #ifdef TEUCHOS_DEBUG
-          << "       insertionNumber = " << entry.second.nodePtr->insertion_number()
+          << "       insertionNumber = " << entry.second.insertionNumber
 #endif
           ;
         ++i;
@@ -374,14 +830,76 @@ void RCPNodeTracer::printActiveRCPNodes(std::ostream &out)
 }
 
 
+int RCPNodeTracer::printFalseSharingCandidates(std::ostream &out,
+  long int minCountIncrements)
+{
+  RCPNodeListLock lock;
+#ifdef TEUCHOS_DEBUG
+  if (!loc_isTracingActiveRCPNodes() || !rcp_node_list())
+    return 0;
+  // Record which hot nodes occupy each cache line
+  const std::size_t lineSize = TEUCHOS_CACHE_LINE_SIZE;
+  typedef std::multimap<std::size_t, const RCPNodeInfo*> line_map_t;
+  line_map_t hotNodesByLine;
+  std::vector<std::size_t> countLines;
+  typedef rcp_node_list_t::const_iterator itr_t;
+  for (itr_t itr = rcp_node_list()->begin(); itr != rcp_node_list()->end(); ++itr) {
+    const RCPNode *rcpNode = itr->second.nodePtr;
+    if (rcpNode && rcpNode->num_count_increments() >= minCountIncrements) {
+      const std::size_t nodeBegin = reinterpret_cast<std::size_t>(rcpNode);
+      const std::size_t nodeEnd = nodeBegin + rcpNode->get_node_size();
+      for (std::size_t line = nodeBegin / lineSize;
+        line <= (nodeEnd - 1) / lineSize; ++line)
+      {
+        hotNodesByLine.insert(std::make_pair(line, &itr->second));
+      }
+      countLines.push_back(
+        reinterpret_cast<std::size_t>(rcpNode->count_address()) / lineSize);
+    }
+  }
+  // Report the lines holding a hot count that other hot nodes also occupy
+  std::sort(countLines.begin(), countLines.end());
+  countLines.erase(std::unique(countLines.begin(), countLines.end()),
+    countLines.end());
+  int numLines = 0;
+  typedef std::vector<std::size_t>::const_iterator count_line_itr_t;
+  for (count_line_itr_t line_itr = countLines.begin();
+    line_itr != countLines.end(); ++line_itr)
+  {
+    if (hotNodesByLine.count(*line_itr) < 2)
+      continue;
+    out << "\nRCPNode objects sharing the cache line at address "
+        << reinterpret_cast<const void*>(*line_itr * lineSize) << ":\n";
+    typedef line_map_t::const_iterator line_itr_t;
+    const std::pair<line_itr_t, line_itr_t> range =
+      hotNodesByLine.equal_range(*line_itr);
+    for (line_itr_t itr = range.first; itr != range.second; ++itr) {
+      const RCPNodeInfo &nodeInfo = *itr->second;
+      out
+        << "  RCPNode address = " << nodeInfo.nodePtr
+        << ", count increments = " << nodeInfo.nodePtr->num_count_increments()
+        << ", insertionNumber = " << nodeInfo.insertionNumber << "\n"
+        << "    Information = " << nodeInfo.info << "\n";
+    }
+    ++numLines;
+  }
+  return numLines;
+#else
+  (void)out;
+  (void)minCountIncrements;
+  return 0;
+#endif
+}
+
+
 // Internal implementation functions
 
 
 void RCPNodeTracer::addNewRCPNode( RCPNode* rcp_node, const std::string &info )
 {
-
+  RCPNodeListLock lock;
   // Used to allow unique identification of rcp_node to allow setting breakpoints
-  static int insertionNumber = 0;
+  const int insertionNumber = loc_insertionNumber();
 
   // Set the insertion number right away in case an exception gets thrown so
   // that you can set a break point to debug this.
@@ -412,7 +930,7 @@ void RCPNodeTracer::addNewRCPNode( RCPNode* rcp_node, const std::string &info )
     bool previous_rcp_node_has_ownership = false;
     for (itr_t itr = itr_itr.first; itr != itr_itr.second; ++itr) {
       previous_rcp_node = itr->second.nodePtr;
-      if (previous_rcp_node->has_ownership()) {
+      if (previous_rcp_node && previous_rcp_node->has_ownership()) {
         previous_rcp_node_has_ownership = true;
         break;
       }
@@ -444,7 +962,7 @@ void RCPNodeTracer::addNewRCPNode( RCPNode* rcp_node, const std::string &info )
     // Add the new RCP node keyed as described above.
     (*rcp_node_list()).insert(
       itr_itr.second,
-      std::make_pair(map_key_void_ptr, RCPNodeInfo(info, rcp_node))
+      std::make_pair(map_key_void_ptr, RCPNodeInfo(info, rcp_node, insertionNumber))
       );
     // NOTE: Above, if there is already an existing RCPNode with the same key
     // value, this iterator itr_itr.second will point to one after the found
@@ -452,14 +970,49 @@ void RCPNodeTracer::addNewRCPNode( RCPNode* rcp_node, const std::string &info )
     // sorted in natural order.
 
     // Update the insertion number an node tracing statistics
-    ++insertionNumber;
-    ++loc_rcpNodeStatistics().totalNumRCPNodeAllocations;
-    loc_rcpNodeStatistics().maxNumRCPNodes =
-      TEUCHOS_MAX(loc_rcpNodeStatistics().maxNumRCPNodes, numActiveRCPNodes());
+    loc_updateRCPNodeStatisticsOnAdd();
   }
 }
 
 
+bool RCPNodeTracer::addNewPolicyRCPNode( const void* policy_node,
+  const std::string &info )
+{
+  RCPNodeListLock lock;
+  if (!loc_isTracingActiveRCPNodes())
+    return false;
+  TEST_FOR_EXCEPT(0==rcp_node_list());
+  TEUCHOS_ASSERT(policy_node);
+  (*rcp_node_list()).insert(
+    std::make_pair(policy_node, RCPNodeInfo(info, 0, loc_insertionNumber()))
+    );
+  loc_updateRCPNodeStatisticsOnAdd();
+  return true;
+}
+
+
+void RCPNodeTracer::removePolicyRCPNode( const void* policy_node )
+{
+  RCPNodeListLock lock;
+  TEUCHOS_ASSERT(rcp_node_list());
+  typedef rcp_node_list_t::iterator itr_t;
+  typedef std::pair<itr_t, itr_t> itr_itr_t;
+  const itr_itr_t itr_itr = rcp_node_list()->equal_range(policy_node);
+  for (itr_t itr = itr_itr.first; itr != itr_itr.second; ++itr) {
+    if (itr->second.nodePtr == 0) {
+      rcp_node_list()->erase(itr);
+      ++loc_rcpNodeStatistics().totalNumRCPNodeDeletions;
+      return;
+    }
+  }
+  TEST_FOR_EXCEPTION(true, std::logic_error,
+    "RCPNodeTracer::removePolicyRCPNode(policy_node): Error, the node "
+    << policy_node << " is not found in the list of active RCP nodes being"
+    " traced.  This should not be possible and can only be an internal"
+    " programming error!");
+}
+
+
 #define TEUCHOS_RCPNODE_REMOVE_RCPNODE(CONDITION, RCPNODE) \
   TEST_FOR_EXCEPTION((CONDITION), \
     std::logic_error, \
@@ -471,7 +1024,7 @@ void RCPNodeTracer::addNewRCPNode( RCPNode* rcp_node, const std::string &info )
 
 void RCPNodeTracer::removeRCPNode( RCPNode* rcp_node )
 {
-
+  RCPNodeListLock lock;
   // Here, we will try to remove an RCPNode reguardless if whether
   // loc_isTracingActiveRCPNodes==true or not.  This will not be a performance
   // problem and it will ensure that any RCPNode objects that are added to
@@ -526,6 +1079,7 @@ void RCPNodeTracer::removeRCPNode( RCPNode* rcp_node )
 
 RCPNode* RCPNodeTracer::getExistingRCPNodeGivenLookupKey(const void* p)
 {
+  RCPNodeListLock lock;
   typedef rcp_node_list_t::iterator itr_t;
   typedef std::pair<itr_t, itr_t> itr_itr_t;
   if (!p)
@@ -533,7 +1087,7 @@ RCPNode* RCPNodeTracer::getExistingRCPNodeGivenLookupKey(const void* p)
   const itr_itr_t itr_itr = rcp_node_list()->equal_range(p);
   for (itr_t itr = itr_itr.first; itr != itr_itr.second; ++itr) {
     RCPNode* rcpNode = itr->second.nodePtr;
-    if (rcpNode->has_ownership()) {
+    if (rcpNode && rcpNode->has_ownership()) {
       return rcpNode;
     }
   }
@@ -595,6 +1149,64 @@ std::string RCPNodeTracer::getCommonDebugNotesString()
 }
 
 
+//
+// Fast exit
+//
+
+
+void setRCPFastExit(bool fastExit)
+{
+  loc_fastExit() = fastExit;
+  if (fastExit) {
+    // Registered only once (the handler checks if fast-exit mode is still on)
+    static const int s_registered = std::atexit(loc_fastExitHandler);
+    (void)s_registered;
+  }
+}
+
+
+bool getRCPFastExit()
+{
+  return loc_fastExit();
+}
+
+
+void RCPFastExitState::set_in_progress()
+{
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  in_progress_.store(true, std::memory_order_release);
+#else
+  in_progress_ = true;
+#endif
+}
+
+
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+std::atomic<bool> RCPFastExitState::in_progress_(false);
+#else
+bool RCPFastExitState::in_progress_ = false;
+#endif
+
+
+void rcpFastExit(int status)
+{
+  loc_fastExit() = true;
+  loc_fastExitHandler();
+  loc_printFastExitSummary();
+#ifdef HAVE_TEUCHOS_CXX11
+  std::_Exit(status);
+#else
+  std::exit(status); // No std::_Exit() but fast exit is in progress
+#endif
+}
+
+
+void addRCPFastExitFinalizer(void (*finalizer)())
+{
+  loc_fastExitFinalizers().push_back(finalizer);
+}
+
+
 //
 // ActiveRCPNodesSetup
 //
@@ -605,8 +1217,7 @@ ActiveRCPNodesSetup::ActiveRCPNodesSetup()
 #ifdef TEUCHOS_SHOW_ACTIVE_REFCOUNTPTR_NODE_TRACE
   std::cerr << "\nCalled ActiveRCPNodesSetup::ActiveRCPNodesSetup() : count = " << count_ << "\n";
 #endif // TEUCHOS_SHOW_ACTIVE_REFCOUNTPTR_NODE_TRACE
-  if (!rcp_node_list())
-    rcp_node_list() = new rcp_node_list_t;
+  rcp_node_list(); // Make sure created!
   ++count_;
 }
 
@@ -622,6 +1233,11 @@ ActiveRCPNodesSetup::~ActiveRCPNodesSetup()
 #endif // TEUCHOS_SHOW_ACTIVE_REFCOUNTPTR_NODE_TRACE
     std::cout << std::flush;
     TEST_FOR_EXCEPT(0==rcp_node_list());
+    if (Teuchos::isRCPFastExitInProgress()) {
+      // Just a summary and leave the list for the OS to clean up
+      loc_printFastExitSummary();
+      return;
+    }
     RCPNodeTracer::RCPNodeStatistics rcpNodeStatistics =
       RCPNodeTracer::getRCPNodeStatistics();
     if (rcpNodeStatistics.maxNumRCPNodes
@@ -630,12 +1246,22 @@ ActiveRCPNodesSetup::~ActiveRCPNodesSetup()
       RCPNodeTracer::printRCPNodeStatistics(rcpNodeStatistics, std::cout);
     }
     RCPNodeTracer::printActiveRCPNodes(std::cerr);
-    delete rcp_node_list();
-    rcp_node_list() = 0;
   }
 }
 
 
+void ActiveRCPNodesSetup::impl_setup()
+{
+  static ActiveRCPNodesSetup s_activeRCPNodesSetup;
+  (void)s_activeRCPNodesSetup;
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  is_setup_.store(true, std::memory_order_release);
+#else
+  is_setup_ = true;
+#endif
+}
+
+
 void Teuchos::ActiveRCPNodesSetup::foo()
 {
   int dummy = count_;
@@ -646,6 +1272,13 @@ void Teuchos::ActiveRCPNodesSetup::foo()
 int Teuchos::ActiveRCPNodesSetup::count_ = 0;
 
 
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+std::atomic<bool> Teuchos::ActiveRCPNodesSetup::is_setup_(false);
+#else
+bool Teuchos::ActiveRCPNodesSetup::is_setup_ = false;
+#endif
+
+
 //
 // RCPNodeHandle
 //
@@ -653,14 +1286,23 @@ int Teuchos::ActiveRCPNodesSetup::count_ = 0;
 
 void RCPNodeHandle::unbindOne()
 {
+  if (node_ && Teuchos::isRCPFastExitInProgress()) {
+    // Leave the object and node for the OS to clean up
+    node_ = 0;
+    return;
+  }
   if (node_) {
-    // NOTE: We only deincrement the reference count after
-    // we have called delete on the underlying object since
-    // that call to delete may actually thrown an exception!
-    if (node_->strong_count()==1 && strength()==RCP_STRONG) {
-      // Delete the object (which might throw)
-      node_->delete_obj();
- #ifdef TEUCHOS_DEBUG
+    // NOTE: unbind() has not changed the reference count yet.
+    ERCPStrength strength = strength_;
+    if (strength == RCP_STRONG) {
+      // Trade the last strong reference for a weak one before deleting the
+      // object so that the node is kept alive by it while any weak references
+      // come and go during the delete.  If another strong reference was
+      // added since unbind() looked at the count (i.e. a weak reference was
+      // promoted on another thread), this just releases ours.
+      if (!node_->convert_last_strong_to_weak())
+        return;
+#ifdef TEUCHOS_DEBUG
       // We actaully also need to remove the RCPNode from the active list for
       // some specialized use cases that need to be able to create a new RCP
       // node pointing to the same memory.  What this means is that when the
@@ -668,25 +1310,119 @@ void RCPNodeHandle::unbindOne()
       // then it will not longer be picked up by any other code and instead it
       // will only be known by its remaining weak RCPNodeHandle objects in
       // order to perform debug-mode runtime checking in case a client tries
-      // to access the obejct.
-      local_activeRCPNodesSetup.foo(); // Make sure created!
+      // to access the obejct.  This is done before the object is deleted
+      // since another thread may get the same memory (or the same object from
+      // an RCPObjectPool) and add a new node for it as soon as it is freed.
       RCPNodeTracer::removeRCPNode(node_);
 #endif
-   }
+      TEUCHOS_TRY {
+        // Delete the object (which might throw)
+        node_->delete_obj();
+      }
+      TEUCHOS_CATCH_ALL {
+#ifdef TEUCHOS_DEBUG
+        RCPNodeTracer::addNewRCPNode(node_, convertRCPNodeToString(node_));
+#endif
+        node_->convert_weak_to_strong();
+        TEUCHOS_RETHROW;
+      }
+      strength = RCP_WEAK;
+    }
     // If we get here, no exception was thrown!
-    if ( (node_->strong_count() + node_->weak_count()) == 1 ) {
+    if (node_->deincr_count_is_last(strength)) {
       // The last RCP object is going away so time to delete
       // the entire node!
       delete node_;
       node_ = 0;
-      // NOTE: No need to deincrement the reference count since this is
-      // the last RCP object being deleted!
+    }
+  }
+}
+
+
+namespace {
+
+
+inline void prefetchRCPNode(const Teuchos::RCPNode *node)
+{
+#if defined(__GNUC__)
+  __builtin_prefetch(node, 1);
+#else
+  (void)node;
+#endif
+}
+
+
+// Copy of what is needed from each handle so that sorting does not have to
+// chase the handle pointers
+struct RCPNodeHandleEntry {
+  Teuchos::RCPNode *node;
+  Teuchos::ERCPStrength strength;
+  Teuchos::RCPNodeHandle *handle;
+  bool operator<(const RCPNodeHandleEntry &e) const
+    {
+      if (node != e.node)
+        return std::less<const Teuchos::RCPNode*>()(node, e.node);
+      return strength < e.strength;
+    }
+};
+
+
+} // namespace
+
+
+void RCPNodeHandle::unbind_all( RCPNodeHandle* handles[], std::size_t n,
+  bool groupByNode )
+{
+  // How many entries ahead to prefetch the node
+  const std::size_t prefetchDist = 8;
+  std::vector<RCPNodeHandleEntry> entries;
+  entries.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    if (handles[i]->node_) {
+      const RCPNodeHandleEntry entry = { handles[i]->node_, handles[i]->strength_, handles[i] };
+      entries.push_back(entry);
+    }
+  }
+  if (groupByNode)
+    std::sort(entries.begin(), entries.end());
+  const std::size_t numEntries = entries.size();
+  // Pass 1: Drop all of the references that are not the last one to their
+  // node and collect the handles holding the last ones.
+  std::size_t numLast = 0;
+  for (std::size_t i = 0; i < numEntries && i < prefetchDist; ++i)
+    prefetchRCPNode(entries[i].node);
+  for (std::size_t i = 0; i < numEntries; ) {
+    const RCPNodeHandleEntry &first = entries[i];
+    std::size_t j = i + 1;
+    while (j < numEntries && entries[j].node == first.node
+      && entries[j].strength == first.strength)
+    {
+      ++j;
+    }
+    if (j + prefetchDist - 1 < numEntries)
+      prefetchRCPNode(entries[j+prefetchDist-1].node);
+    // All but one of the references of the run are never the last ones
+    if (j - i > 1)
+      first.node->deincr_count_by(first.strength, static_cast<int>(j - i - 1));
+    for (std::size_t k = i + 1; k < j; ++k) {
+      entries[k].handle->node_ = 0;
+      entries[k].handle->strength_ = RCP_STRENGTH_INVALID;
+    }
+    if (first.node->deincr_count_if_not_last(first.strength)) {
+      first.handle->node_ = 0;
+      first.handle->strength_ = RCP_STRENGTH_INVALID;
     }
     else {
-      // The last RCP has not gone away so just deincrement the reference
-      // count.
-      node_->deincr_count(strength());
+      entries[numLast++] = first;
     }
+    i = j;
+  }
+  // Pass 2: Release the last references, deleting the objects and nodes
+  for (std::size_t i = 0; i < numLast; ++i) {
+    RCPNodeHandle &handle = *entries[i].handle;
+    handle.unbindOne();
+    handle.node_ = 0;
+    handle.strength_ = RCP_STRENGTH_INVALID;
   }
 }
 
@@ -699,6 +1435,39 @@ void RCPNodeHandle::unbindOne()
 //
 
 
+void* Teuchos::allocateCacheLineAligned( std::size_t size )
+{
+  // Over-allocate so that the block can be aligned and the original address
+  // stored just in front of it.  The size is padded so that nothing else
+  // gets allocated in the last line.
+  const std::size_t line = TEUCHOS_CACHE_LINE_SIZE;
+  const std::size_t paddedSize = ((size + line - 1) / line) * line;
+  void *raw = std::malloc(paddedSize + line + sizeof(void*));
+  if (!raw) {
+#ifndef TEUCHOS_NO_EXCEPTIONS
+    throw std::bad_alloc();
+#else
+    TestForException_abort("std::bad_alloc",
+      "Teuchos::allocateCacheLineAligned(" + Teuchos::toString(size)
+      + "): out of memory\n\n" + Teuchos::get_backtrace());
+#endif
+  }
+  const std::size_t rawAddress =
+    reinterpret_cast<std::size_t>(raw) + sizeof(void*);
+  void **aligned = reinterpret_cast<void**>(
+    ((rawAddress + line - 1) / line) * line );
+  aligned[-1] = raw;
+  return aligned;
+}
+
+
+void Teuchos::deallocateCacheLineAligned( void* p )
+{
+  if (p)
+    std::free(static_cast<void**>(p)[-1]);
+}
+
+
 void Teuchos::throw_null_ptr_error( const std::string &type_name )
 {
   TEST_FOR_EXCEPTION(
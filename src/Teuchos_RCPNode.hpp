@@ -45,6 +45,12 @@
 #include "Teuchos_TypeNameTraits.hpp"
 #include "Teuchos_toString.hpp"
 #include "Teuchos_getBaseObjVoidPtr.hpp"
+#include <typeinfo>
+#include <vector>
+
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+#  include <atomic>
+#endif
 
 
 namespace Teuchos {
@@ -116,6 +122,295 @@ public:
 };
 
 
+/** \brief Base class of the tag types used as keys for statically typed
+ * extra data.
+ *
+ * A key is declared once as
+ *
+ \code
+  struct MyKey : ExtraDataKey<Foo> {};
+ \endcode
+ *
+ * and is then used as <tt>set_extra_data<MyKey>(foo, inOutArg(p))</tt> and
+ * <tt>get_extra_data<MyKey>(p)</tt>.  Each key type is given its own slot
+ * index the first time that it is used in the process, so accessing the
+ * data of a key is an index into a small array on the node with no name
+ * string and no <tt>any_cast</tt>.  Keyed extra data lives side by side with
+ * the named extra data set with <tt>set_extra_data(extra_data, name,
+ * ...)</tt> and follows the same <tt>PRE_DESTROY</tt>/<tt>POST_DESTROY</tt>
+ * rules.
+ *
+ * \ingroup teuchos_mem_mng_grp 
+ */
+template<class Value_T>
+class ExtraDataKey {
+public:
+  /** \brief The type of the extra data stored under this key. */
+  typedef Value_T value_type;
+};
+
+
+/** \brief Storage for the extra data attached to a reference-counted node.
+ *
+ * This is not a general user-level class.  It is used in the implementation
+ * of <tt>RCPNode</tt> and of the nodes of <tt>RCP<T,Policy></tt> objects
+ * that support extra data.
+ *
+ * The named entries are kept in a small flat array keyed by the
+ * <tt>std::type_info</tt> of the stored data and the interned name (see
+ * <tt>intern_name()</tt>) together with a hash of the name.  A lookup with
+ * the <tt>std::type_info</tt> overloads is then a linear scan comparing
+ * pointers and hashes that does not build any strings or demangle any type
+ * names (the name itself is only compared to confirm a match).  The first
+ * few entries are stored inline in the single block that is allocated when
+ * extra data is first set on a node; further entries go into more blocks
+ * chained to it.  Entries never move once they are set so references
+ * returned by <tt>get_extra_data()</tt> stay valid.  The data for
+ * <tt>ExtraDataKey</tt> keys is kept in a second array indexed directly by
+ * the slot of the key (see <tt>key_slot()</tt>), so a lookup is a bounds
+ * check and a load.  The array is only grown to the largest slot set on
+ * this node, which costs a pointer per key slot below it whether it is set
+ * or not; keys are meant to be declared once per kind of cached data, so
+ * there are few slots in a process.
+ *
+ * \ingroup teuchos_mem_mng_grp 
+ */
+class TEUCHOS_LIB_DLL_EXPORT RCPNodeExtraData {
+private:
+  struct key_data_base_t {
+    key_data_base_t( EPrePostDestruction _destroy_when )
+      : destroy_when(_destroy_when)
+      {}
+    virtual ~key_data_base_t() {}
+    EPrePostDestruction destroy_when;
+  };
+  template<class T>
+  struct key_data_t : public key_data_base_t {
+    key_data_t( const T &_value, EPrePostDestruction _destroy_when )
+      : key_data_base_t(_destroy_when), value(_value)
+      {}
+    T value;
+  };
+public:
+  /** \brief . */
+  RCPNodeExtraData()
+    : extra_data_(NULL)
+    {}
+  /** \brief . */
+  ~RCPNodeExtraData()
+    {
+      if(extra_data_)
+        impl_delete_extra_data();
+    }
+  /** \brief . */
+  void set_extra_data(
+    const any &extra_data, const std::string& name,
+    EPrePostDestruction destroy_when, bool force_unique );
+#ifdef HAVE_TEUCHOS_CXX11
+  /** \brief Same as above but moves <tt>extra_data</tt> into the node. */
+  void set_extra_data(
+    any &&extra_data, const std::string& name,
+    EPrePostDestruction destroy_when, bool force_unique );
+#endif
+  /** \brief . */
+  any& get_extra_data( const std::type_info& type, const std::string& name );
+  /** \brief . */
+  any* get_optional_extra_data( const std::type_info& type,
+    const std::string& name );
+  /** \brief Lookup by type name (slow, kept for backward compatibility). */
+  any& get_extra_data( const std::string& type_name,
+    const std::string& name );
+  /** \brief Lookup by type name (slow, kept for backward compatibility). */
+  any* get_optional_extra_data(const std::string& type_name,
+    const std::string& name );
+  /** \brief Set (or reset) the data for the key <tt>Key</tt>. */
+  template<class Key>
+  void set_key_data( const typename Key::value_type &value,
+    EPrePostDestruction destroy_when )
+    {
+      typedef key_data_t<typename Key::value_type> data_t;
+      key_data_base_t *&data = key_data_slot(key_slot<Key>());
+      if (data) {
+        static_cast<data_t*>(data)->value = value;
+        data->destroy_when = destroy_when;
+      }
+      else {
+        data = new data_t(value, destroy_when);
+      }
+    }
+  /** \brief Get the data for the key <tt>Key</tt> (throws
+   * <tt>std::invalid_argument</tt> in a debug build if it is not set). */
+  template<class Key>
+  typename Key::value_type& get_key_data()
+    {
+      typename Key::value_type *value = get_optional_key_data<Key>();
+#ifdef TEUCHOS_DEBUG
+      TEST_FOR_EXCEPTION(
+        value == NULL, std::invalid_argument
+        ,"Error, the extra data key \'" << TypeNameTraits<Key>::name()
+        << "\' is not set!" );
+#endif
+      return *value;
+    }
+  /** \brief Get the data for the key <tt>Key</tt> or <tt>NULL</tt> if it is
+   * not set. */
+  template<class Key>
+  typename Key::value_type* get_optional_key_data()
+    {
+      typedef key_data_t<typename Key::value_type> data_t;
+      if (extra_data_ == NULL)
+        return NULL;
+      const std::size_t slot = key_slot<Key>();
+      const keyed_array_t &keyed = extra_data_->keyed;
+      if (slot >= keyed.size() || keyed[slot] == NULL)
+        return NULL;
+      return &static_cast<data_t*>(keyed[slot])->value;
+    }
+  /** \brief The slot index of the key <tt>Key</tt> (assigned on first
+   * use). */
+  template<class Key>
+  static int key_slot()
+    {
+      static const int slot = allocate_key_slot();
+      return slot;
+    }
+  /** \brief Allocate a new key slot index (see <tt>key_slot()</tt>). */
+  static int allocate_key_slot();
+  /** \brief . */
+  void pre_delete_extra_data()
+    {
+      if(extra_data_)
+        impl_pre_delete_extra_data();
+    }
+  /** \brief Return the interned copy of <tt>name</tt>.
+   *
+   * The names of the extra data are interned process wide and never freed,
+   * so each entry only holds a pointer to its name.
+   */
+  static const std::string* intern_name( const std::string& name );
+private:
+  struct extra_data_entry_t {
+    extra_data_entry_t()
+      : type(0), name(0), name_hash(0), destroy_when(POST_DESTROY)
+      {}
+    bool matches( const std::type_info &_type, std::size_t _name_hash,
+      const std::string &_name ) const
+      {
+        // Compare the type_info addresses first since they are almost always
+        // unique, but fall back on operator== for types shared across
+        // shared libraries.
+        return name_hash == _name_hash && (type == &_type || *type == _type)
+          && *name == _name;
+      }
+    const std::type_info *type;
+    const std::string *name; // Interned
+    std::size_t name_hash;
+    any extra_data;
+    EPrePostDestruction destroy_when;
+  }; 
+  enum { numEntriesPerBlock = 4 };
+  struct extra_data_block_t {
+    extra_data_block_t() : numEntries(0), next(0) {}
+    ~extra_data_block_t() { delete next; }
+    extra_data_entry_t entries[numEntriesPerBlock];
+    int numEntries;
+    extra_data_block_t *next; // Owned
+  private:
+    extra_data_block_t(const extra_data_block_t&);
+    extra_data_block_t& operator=(const extra_data_block_t&);
+  };
+  // Owned, NULL for the keys that are not set
+  typedef std::vector<key_data_base_t*> keyed_array_t;
+  struct extra_data_t {
+    extra_data_block_t entries; // The first block is inline
+    keyed_array_t keyed; // Indexed by key slot
+  };
+  extra_data_t *extra_data_;
+  // Above is made a pointer to reduce overhead for the general case when this
+  // is not used.  However, this adds just a little bit to the overhead when
+  // it is used.
+  static std::size_t hash_name( const std::string& name );
+  extra_data_entry_t* find_entry( const std::type_info& type,
+    const std::string& name );
+  key_data_base_t*& key_data_slot( int slot );
+  // Postconditions: extra_data.empty()
+  void impl_set_extra_data(
+    any &extra_data, const std::string& name,
+    EPrePostDestruction destroy_when, bool force_unique );
+  // Provides the "basic" guarantee!
+  void impl_pre_delete_extra_data();
+  void impl_delete_extra_data();
+  // Not defined and not to be called
+  RCPNodeExtraData(const RCPNodeExtraData&);
+  RCPNodeExtraData& operator=(const RCPNodeExtraData&);
+};
+
+
+class RCPNode;
+
+
+/** \brief Base class for callbacks that are called when the object of an
+ * RCPNode is deleted.
+ *
+ * A callback is registered on the node of an RCP with
+ * <tt>add_destroy_callback()</tt> and is called once, right before
+ * (<tt>PRE_DESTROY</tt>) or right after (<tt>POST_DESTROY</tt>) the object is
+ * deleted, that is when the last strong RCP to the object goes away.
+ * Callbacks of the same kind are called in the reverse order that they were
+ * registered.  A callback is unregistered before it is called so it may
+ * delete itself in <tt>on_destroy()</tt>.
+ *
+ * The callback objects are owned by the client and are linked into the node
+ * (no allocations and no string lookups as with extra data).  Unregistering
+ * takes constant time and is done automatically on destruction.
+ *
+ * In a thread-safe build (<tt>HAVE_TEUCHOS_THREAD_SAFE</tt>), registering
+ * and unregistering can happen on any thread but the client must make sure
+ * that a callback object is not destroyed while it is being called.
+ *
+ * \ingroup teuchos_mem_mng_grp 
+ */
+class TEUCHOS_LIB_DLL_EXPORT RCPNodeDestroyCallback {
+public:
+  /** \brief . */
+  RCPNodeDestroyCallback()
+    : node_(0), prev_(0), next_(0), destroy_when_(POST_DESTROY)
+    {}
+  /** \brief Unregisters the callback. */
+  virtual ~RCPNodeDestroyCallback()
+    {
+      unregister();
+    }
+  /** \brief Called when the object is deleted.  Must not throw. */
+  virtual void on_destroy(EPrePostDestruction destroy_when) = 0;
+  /** \brief Return if the callback is registered on a node and has not
+   * been called yet. */
+  bool is_registered() const;
+  /** \brief Remove the callback from its node.
+   *
+   * \returns <tt>false</tt> if the callback was not registered (or has
+   * already been called).
+   */
+  bool unregister();
+private:
+  RCPNode *node_;
+  RCPNodeDestroyCallback *prev_;
+  RCPNodeDestroyCallback *next_;
+  EPrePostDestruction destroy_when_;
+  friend class RCPNode;
+  // Not defined and not to be called
+  RCPNodeDestroyCallback(const RCPNodeDestroyCallback&);
+  RCPNodeDestroyCallback& operator=(const RCPNodeDestroyCallback&);
+};
+
+
+#ifndef TEUCHOS_CACHE_LINE_SIZE
+/** \brief Cache line size (bytes) used to align and pad hot RCPNode
+ * objects. */
+#  define TEUCHOS_CACHE_LINE_SIZE 64
+#endif
+
+
 /** \brief Node class to keep track of address and the reference count for a
  * reference-counted utility class and delete the object.
  *
@@ -131,47 +426,168 @@ class TEUCHOS_LIB_DLL_EXPORT RCPNode {
 public:
   /** \brief . */
   RCPNode(bool has_ownership_in)
-    : has_ownership_(has_ownership_in), extra_data_map_(NULL)
+    : count_(0), has_ownership_(has_ownership_in), destroy_callbacks_(0)
 #ifdef TEUCHOS_DEBUG
-    ,insertion_number_(-1)
+    ,insertion_number_(-1), num_count_incrs_(0)
 #endif // TEUCHOS_DEBUG
-    {
-      count_[RCP_STRONG] = 0;
-      count_[RCP_WEAK] = 0;
-    }
+    {}
   /** \brief . */
   virtual ~RCPNode()
     {
-      if(extra_data_map_)
-        delete extra_data_map_;
+      if (has_destroy_callbacks())
+        unlink_destroy_callbacks();
     }
   /** \brief . */
   int strong_count() const
     {
-      return count_[RCP_STRONG]; 
+      return count_part(load_count(), RCP_STRONG);
     }
   /** \brief . */
   int weak_count() const
     {
-      return count_[RCP_WEAK];
+      return count_part(load_count(), RCP_WEAK);
     }
   /** \brief . */
   int count( const ERCPStrength strength )
     {
       debugAssertStrength(strength);
-      return count_[strength];
+      return count_part(load_count(), strength);
     }
   /** \brief . */
   int incr_count( const ERCPStrength strength )
     {
       debugAssertStrength(strength);
-      return ++count_[strength];
+      debug_incr_num_count_incrs();
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      const count_word_t count =
+        count_.fetch_add(count_unit(strength), std::memory_order_relaxed);
+      return count_part(count, strength) + 1;
+#else
+      count_ += count_unit(strength);
+      return count_part(count_, strength);
+#endif
     }
   /** \brief . */
   int deincr_count( const ERCPStrength strength )
     {
       debugAssertStrength(strength);
-      return --count_[strength];
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      const count_word_t count =
+        count_.fetch_sub(count_unit(strength), std::memory_order_acq_rel);
+      return count_part(count, strength) - 1;
+#else
+      count_ -= count_unit(strength);
+      return count_part(count_, strength);
+#endif
+    }
+  /** \brief Deincrement the count unless this is the last strong reference
+   * or the last reference of any kind, in which case nothing is changed and
+   * <tt>false</tt> is returned.
+   */
+  bool deincr_count_if_not_last( const ERCPStrength strength )
+    {
+      debugAssertStrength(strength);
+      const count_word_t unit = count_unit(strength);
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      count_word_t count = count_.load(std::memory_order_relaxed);
+      do {
+        if (is_last_count(count, strength))
+          return false;
+      } while (!count_.compare_exchange_weak(count, count - unit,
+          std::memory_order_acq_rel, std::memory_order_relaxed));
+#else
+      if (is_last_count(count_, strength))
+        return false;
+      count_ -= unit;
+#endif
+      return true;
+    }
+  /** \brief Increment the strong count only if it is not zero and return if
+   * it was incremented.
+   *
+   * This is the safe way to promote a weak reference to a strong one when
+   * another thread may be releasing the last strong reference.
+   */
+  bool incr_strong_count_if_nonzero()
+    {
+      debug_incr_num_count_incrs();
+      const count_word_t unit = count_unit(RCP_STRONG);
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      count_word_t count = count_.load(std::memory_order_relaxed);
+      do {
+        if (count_part(count, RCP_STRONG) == 0)
+          return false;
+      } while (!count_.compare_exchange_weak(count, count + unit,
+          std::memory_order_acq_rel, std::memory_order_relaxed));
+#else
+      if (count_part(count_, RCP_STRONG) == 0)
+        return false;
+      count_ += unit;
+#endif
+      return true;
+    }
+  /** \brief Release a strong reference in a single atomic step: if it is
+   * the last one, it is turned into a weak reference (which keeps the node
+   * alive while the object is deleted) and <tt>true</tt> is returned;
+   * otherwise the strong count is just deincremented.
+   *
+   * Checking the count and converting it separately would race with
+   * <tt>incr_strong_count_if_nonzero()</tt> promoting a weak reference in
+   * between, after which the object would be deleted while still strongly
+   * referenced.
+   */
+  bool convert_last_strong_to_weak()
+    {
+      const count_word_t unit = count_unit(RCP_STRONG);
+      const count_word_t convert = count_unit(RCP_WEAK) - unit;
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      count_word_t count = count_.load(std::memory_order_relaxed);
+      bool last = false;
+      do {
+        last = (count_part(count, RCP_STRONG) == 1);
+      } while (!count_.compare_exchange_weak(count,
+          last ? count + convert : count - unit,
+          std::memory_order_acq_rel, std::memory_order_relaxed));
+      return last;
+#else
+      const bool last = (count_part(count_, RCP_STRONG) == 1);
+      count_ += last ? convert : static_cast<count_word_t>(0) - unit;
+      return last;
+#endif
+    }
+  /** \brief Undo <tt>convert_last_strong_to_weak()</tt>. */
+  void convert_weak_to_strong()
+    {
+      shift_count(count_unit(RCP_STRONG) - count_unit(RCP_WEAK));
+    }
+  /** \brief Deincrement the count and return <tt>true</tt> if there are no
+   * references of any kind left and the node must be deleted.
+   */
+  bool deincr_count_is_last( const ERCPStrength strength )
+    {
+      debugAssertStrength(strength);
+      const count_word_t unit = count_unit(strength);
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      return count_.fetch_sub(unit, std::memory_order_acq_rel) == unit;
+#else
+      count_ -= unit;
+      return count_ == 0;
+#endif
+    }
+  /** \brief Deincrement the count by <tt>n</tt> in one step.
+   *
+   * The caller must make sure that at least one reference of the given
+   * strength is left afterwards.
+   */
+  void deincr_count_by( const ERCPStrength strength, const int n )
+    {
+      debugAssertStrength(strength);
+      const count_word_t delta = count_unit(strength) * static_cast<count_word_t>(n);
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      count_.fetch_sub(delta, std::memory_order_acq_rel);
+#else
+      count_ -= delta;
+#endif
     }
   /** \brief . */
   void has_ownership(bool has_ownership_in)
@@ -186,10 +602,56 @@ public:
   /** \brief . */
   void set_extra_data(
     const any &extra_data, const std::string& name,
-    EPrePostDestruction destroy_when, bool force_unique );
+    EPrePostDestruction destroy_when, bool force_unique )
+    {
+      extra_data_.set_extra_data(extra_data, name, destroy_when, force_unique);
+    }
+#ifdef HAVE_TEUCHOS_CXX11
+  /** \brief . */
+  void set_extra_data(
+    any &&extra_data, const std::string& name,
+    EPrePostDestruction destroy_when, bool force_unique )
+    {
+      extra_data_.set_extra_data(std::move(extra_data), name, destroy_when,
+        force_unique);
+    }
+#endif
+  /** \brief . */
+  RCPNodeExtraData& extra_data()
+    {
+      return extra_data_;
+    }
+  /** \brief . */
+  any& get_extra_data( const std::type_info& type, const std::string& name )
+    {
+      return extra_data_.get_extra_data(type, name);
+    }
+  /** \brief . */
+  const any& get_extra_data( const std::type_info& type,
+    const std::string& name
+    ) const
+    {
+      return const_cast<RCPNode*>(this)->get_extra_data(type, name);
+    }
+  /** \brief . */
+  any* get_optional_extra_data( const std::type_info& type,
+    const std::string& name )
+    {
+      return extra_data_.get_optional_extra_data(type, name);
+    }
+  /** \brief . */
+  const any* get_optional_extra_data( const std::type_info& type,
+    const std::string& name
+    ) const
+    {
+      return const_cast<RCPNode*>(this)->get_optional_extra_data(type, name);
+    }
   /** \brief . */
   any& get_extra_data( const std::string& type_name,
-    const std::string& name );
+    const std::string& name )
+    {
+      return extra_data_.get_extra_data(type_name, name);
+    }
   /** \brief . */
   const any& get_extra_data( const std::string& type_name,
     const std::string& name
@@ -199,7 +661,10 @@ public:
     }
   /** \brief . */
   any* get_optional_extra_data(const std::string& type_name,
-    const std::string& name );
+    const std::string& name )
+    {
+      return extra_data_.get_optional_extra_data(type_name, name);
+    }
   /** \brief . */
   const any* get_optional_extra_data(
     const std::string& type_name, const std::string& name
@@ -223,39 +688,134 @@ public:
 #ifdef TEUCHOS_DEBUG
   /** \brief . */
   virtual const void* get_base_obj_map_key_void_ptr() const = 0;
+  /** \brief Number of bytes taken up by the concrete node object. */
+  virtual std::size_t get_node_size() const = 0;
 #endif
+  /** \brief Register a callback to be called when the object is deleted.
+   *
+   * <b>Preconditions:</b><ul>
+   * <li><tt>!callback.is_registered()</tt>
+   * </ul>
+   */
+  void add_destroy_callback( RCPNodeDestroyCallback &callback,
+    EPrePostDestruction destroy_when );
 protected:
   /** \brief . */
   void pre_delete_extra_data()
     {
-      if(extra_data_map_)
-        impl_pre_delete_extra_data();
+      extra_data_.pre_delete_extra_data();
+    }
+  /** \brief Call (and unregister) the callbacks for
+   * <tt>destroy_when</tt>. */
+  void call_destroy_callbacks( EPrePostDestruction destroy_when )
+    {
+      if (has_destroy_callbacks())
+        impl_call_destroy_callbacks(destroy_when);
     }
 private:
-  struct extra_data_entry_t {
-    extra_data_entry_t() : destroy_when(POST_DESTROY) {}
-    extra_data_entry_t( const any &_extra_data, EPrePostDestruction _destroy_when )
-      : extra_data(_extra_data), destroy_when(_destroy_when)
-      {}
-    any extra_data;
-    EPrePostDestruction destroy_when;
-  }; 
-  typedef Teuchos::map<std::string,extra_data_entry_t> extra_data_map_t;
-  int count_[2];
+  // The strong count is in the low and the weak count in the high 32 bits of
+  // one word so that each transition is a single (atomic) operation and the
+  // total count is seen consistently.
+  typedef unsigned long long count_word_t;
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  std::atomic<count_word_t> count_;
+#else
+  count_word_t count_;
+#endif
   bool has_ownership_;
-  extra_data_map_t *extra_data_map_;
-  // Above is made a pointer to reduce overhead for the general case when this
-  // is not used.  However, this adds just a little bit to the overhead when
-  // it is used.
-  // Provides the "basic" guarantee!
-  void impl_pre_delete_extra_data();
+  RCPNodeExtraData extra_data_;
+  // Head of the intrusive list of callbacks (see RCPNodeDestroyCallback).
+  // Only changed while holding the callback lock.
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  std::atomic<RCPNodeDestroyCallback*> destroy_callbacks_;
+#else
+  RCPNodeDestroyCallback *destroy_callbacks_;
+#endif
+  bool has_destroy_callbacks() const
+    {
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      return destroy_callbacks_.load(std::memory_order_acquire) != 0;
+#else
+      return destroy_callbacks_ != 0;
+#endif
+    }
+  void impl_call_destroy_callbacks( EPrePostDestruction destroy_when );
+  void unlink_destroy_callbacks();
+  friend class RCPNodeDestroyCallback;
+  static count_word_t count_unit( const ERCPStrength strength )
+    {
+      return strength == RCP_STRONG
+        ? static_cast<count_word_t>(1) : static_cast<count_word_t>(1) << 32;
+    }
+  static int count_part( const count_word_t count, const ERCPStrength strength )
+    {
+      return static_cast<int>( strength == RCP_STRONG
+        ? (count & 0xFFFFFFFFu) : (count >> 32) );
+    }
+  static bool is_last_count( const count_word_t count,
+    const ERCPStrength strength )
+    {
+      return count == count_unit(strength)
+        || (strength == RCP_STRONG && count_part(count, RCP_STRONG) == 1);
+    }
+  count_word_t load_count() const
+    {
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      return count_.load(std::memory_order_acquire);
+#else
+      return count_;
+#endif
+    }
+  void debug_incr_num_count_incrs()
+    {
+#ifdef TEUCHOS_DEBUG
+#  ifdef HAVE_TEUCHOS_THREAD_SAFE
+      // Not a read-modify-write so this adds no locked instruction to each
+      // increment.  Increments on other threads at the same time may get
+      // lost, which is fine for telling hot nodes from cold ones.
+      num_count_incrs_.store(num_count_incrs_.load(std::memory_order_relaxed)
+        + 1, std::memory_order_relaxed);
+#  else
+      ++num_count_incrs_;
+#  endif
+#endif
+    }
+  void shift_count( const count_word_t delta )
+    {
+      // Unsigned wrap-around makes this subtract from one half while adding
+      // to the other.
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      count_.fetch_add(delta, std::memory_order_acq_rel);
+#else
+      count_ += delta;
+#endif
+    }
   // Not defined and not to be called
   RCPNode();
   RCPNode(const RCPNode&);
   RCPNode& operator=(const RCPNode&);
 #ifdef TEUCHOS_DEBUG
   int insertion_number_;
+  // Keeps num_count_incrs_ off the cache line of count_ so that counting the
+  // increments does not add writes to the line being diagnosed
+  char num_count_incrs_pad_[TEUCHOS_CACHE_LINE_SIZE];
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  std::atomic<long int> num_count_incrs_;
+#else
+  long int num_count_incrs_;
+#endif
 public:
+  /** \brief Number of references that have been added to this node (on any
+   * thread, approximate in a thread-safe build). */
+  long int num_count_increments() const
+    {
+      return num_count_incrs_;
+    }
+  /** \brief Address of the reference count word. */
+  const void* count_address() const
+    {
+      return &count_;
+    }
   void set_insertion_number(int insertion_number_in)
     {
       insertion_number_ = insertion_number_in;
@@ -380,6 +940,26 @@ public:
    */
   static TEUCHOS_LIB_DLL_EXPORT void printActiveRCPNodes(std::ostream &out);
 
+  /** \brief Print the groups of active "hot" RCPNode objects, i.e. nodes
+   * that have each had at least <tt>minCountIncrements</tt> references added
+   * to them, where the reference count of one shares a cache line with
+   * another.
+   *
+   * Only the number of increments is recorded, not which threads made them,
+   * so this reports candidates: if the nodes sharing a line are used from
+   * different threads, their count updates false-share the line.  Confirm
+   * with a tool that sees the actual cache traffic (e.g. <tt>perf c2c</tt>)
+   * and then consider aligning the nodes of the reported types with
+   * <tt>TEUCHOS_RCP_NODE_CACHE_LINE_ALIGNED()</tt>.
+   *
+   * This only reports traced nodes and so will print nothing unless node
+   * tracing is active in a debug build.
+   *
+   * \returns The number of cache lines reported.
+   */
+  static TEUCHOS_LIB_DLL_EXPORT int printFalseSharingCandidates(
+    std::ostream &out, long int minCountIncrements = 1000);
+
   //@}
 
   /** \name Internal implementation functions (not to be called by general
@@ -401,6 +981,24 @@ public:
    */
   static TEUCHOS_LIB_DLL_EXPORT void removeRCPNode( RCPNode* rcp_node );
 
+  /** \brief Add the node of a traced <tt>RCP<T,Policy></tt> object to the
+   * global list if node tracing is active.
+   *
+   * Such a node is not an <tt>RCPNode</tt> so it is keyed by its own address
+   * and it is never returned from <tt>getExistingRCPNode()</tt>.
+   *
+   * \returns <tt>true</tt> if the node was added (and must be removed with
+   * <tt>removePolicyRCPNode()</tt>).
+   */
+  static TEUCHOS_LIB_DLL_EXPORT bool addNewPolicyRCPNode(
+    const void* policy_node, const std::string &info );
+
+  /** \brief Remove the node of a traced <tt>RCP<T,Policy></tt> object from
+   * the global list.
+   */
+  static TEUCHOS_LIB_DLL_EXPORT void removePolicyRCPNode(
+    const void* policy_node );
+
   /** \brief Get a <tt>const void*</tt> address to be used as the lookup key
    * for an RCPNode given its embedded object's typed pointer.
    *
@@ -456,6 +1054,104 @@ public:
 };
 
 
+/** \brief Turn fast-exit mode on or off.
+ *
+ * When fast-exit mode is on at the time the program exits normally (by
+ * returning from <tt>main()</tt> or calling <tt>exit()</tt>), an exit handler
+ * calls the functions registered with <tt>addRCPFastExitFinalizer()</tt>,
+ * flushes the standard streams and from then on lets any <tt>RCP</tt> that
+ * is destroyed just leak its object and node instead of deleting them.  This
+ * makes static <tt>RCP</tt> objects that hold large object graphs cheap (and
+ * safe, whatever the destruction order) to destroy and leaves it to the
+ * operating system to reclaim the memory.  In a debug build, only a one-line
+ * summary of the remaining active nodes is printed instead of the full
+ * report.
+ *
+ * Fast-exit mode is also turned on when the environment variable
+ * <tt>TEUCHOS_RCP_FAST_EXIT</tt> is set to <tt>1</tt>, <tt>ON</tt>,
+ * <tt>TRUE</tt> or <tt>YES</tt> when the Teuchos library is loaded.
+ *
+ * The exit handler is registered (with <tt>std::atexit()</tt>) the first
+ * time fast-exit mode is turned on, and it only runs before the destructors
+ * of static objects that were constructed before that (for the environment
+ * variable, that is when the library is loaded).  Call this function with
+ * <tt>true</tt> at the start of <tt>main()</tt> to cover all global objects
+ * or call <tt>rcpFastExit()</tt> instead of returning from <tt>main()</tt> to
+ * skip all teardown.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+TEUCHOS_LIB_DLL_EXPORT void setRCPFastExit(bool fastExit);
+
+
+/** \brief Return if fast-exit mode is on.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+TEUCHOS_LIB_DLL_EXPORT bool getRCPFastExit();
+
+
+/** \brief Fast-exit state that is read inline on the release paths.
+ *
+ * This is not a general user-level class.
+ */
+class TEUCHOS_LIB_DLL_EXPORT RCPFastExitState {
+public:
+  /** \brief . */
+  static bool in_progress()
+    {
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      return in_progress_.load(std::memory_order_relaxed);
+#else
+      return in_progress_;
+#endif
+    }
+  /** \brief Called by the fast-exit handler once objects are no longer
+   * deleted. */
+  static void set_in_progress();
+private:
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  static std::atomic<bool> in_progress_;
+#else
+  static bool in_progress_;
+#endif
+};
+
+
+/** \brief Return if the program is exiting in fast-exit mode (i.e. objects
+ * are no longer deleted).
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+inline bool isRCPFastExitInProgress()
+{
+  return RCPFastExitState::in_progress();
+}
+
+
+/** \brief Exit the program right away in fast-exit mode.
+ *
+ * Calls the fast-exit finalizers, flushes the standard streams and then
+ * ends the program with <tt>std::_Exit(status)</tt> without running any
+ * destructors or exit handlers.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+TEUCHOS_LIB_DLL_EXPORT void rcpFastExit(int status);
+
+
+/** \brief Register a function that must still be called when the program
+ * exits in fast-exit mode (e.g. to flush a log or close a file).
+ *
+ * The functions are called in the reverse order of their registration and
+ * only in fast-exit mode.  This function is not thread safe and should be
+ * called during startup.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+TEUCHOS_LIB_DLL_EXPORT void addRCPFastExitFinalizer(void (*finalizer)());
+
+
 #ifdef TEUCHOS_DEBUG
 #  define TEUCHOS_RCP_INSERION_NUMBER_STR() \
       "  insertionNumber:      " << rcp_node_ptr->insertion_number() << "\n"
@@ -479,7 +1175,7 @@ public:
       base_obj_map_key_void_ptr_(RCPNodeTracer::getRCPNodeBaseObjMapKeyVoidPtr(p)),
       deleted_ptr_(0),
 #endif
-      dealloc_(dealloc)
+      dealloc_(TEUCHOS_MOVE(dealloc))
     {}
   /** \brief For undefined types . */
   RCPNodeTmpl(T* p, Dealloc_T dealloc, bool has_ownership_in, ENull)
@@ -488,7 +1184,7 @@ public:
       base_obj_map_key_void_ptr_(0),
       deleted_ptr_(0),
 #endif
-      dealloc_(dealloc)
+      dealloc_(TEUCHOS_MOVE(dealloc))
     {}
   /** \brief . */
   Dealloc_T& get_nonconst_dealloc()
@@ -500,7 +1196,7 @@ public:
   ~RCPNodeTmpl()
     {
 #ifdef TEUCHOS_DEBUG
-      TEST_FOR_EXCEPTION( ptr_!=0, std::logic_error,
+      TEST_FOR_TERMINATION( ptr_!=0,
         "Error, the underlying object must be explicitly deleted before deleting"
         " the node object!" );
 #endif
@@ -519,6 +1215,7 @@ public:
     {
       if (ptr_!= 0) {
         this->pre_delete_extra_data(); // May throw!
+        this->call_destroy_callbacks(PRE_DESTROY);
         T* tmp_ptr = ptr_;
 #ifdef TEUCHOS_DEBUG
         deleted_ptr_ = tmp_ptr;
@@ -526,15 +1223,15 @@ public:
         ptr_ = 0;
         if (has_ownership()) {
 #ifdef TEUCHOS_DEBUG
-          try {
+          TEUCHOS_TRY {
 #endif
             dealloc_.free(tmp_ptr);
 #ifdef TEUCHOS_DEBUG
           }
-          catch(...) {
+          TEUCHOS_CATCH_ALL {
             // Object was not deleted due to an exception!
             ptr_ = tmp_ptr;
-            throw;
+            TEUCHOS_RETHROW;
           }
 #endif
         }
@@ -548,6 +1245,9 @@ public:
         // "strong" guarantee we have to include the above try/catch.  This
         // overhead is unfortunate but I don't know of any other way to
         // statisfy the "strong" guarantee and still avoid a double delete.
+        // NOTE: The handle that calls delete_obj() keeps the node itself
+        // alive until this returns so the node can still be used here.
+        this->call_destroy_callbacks(POST_DESTROY);
       }
     }
   /** \brief . */
@@ -608,6 +1308,11 @@ public:
     {
       return base_obj_map_key_void_ptr_;
     }
+  /** \brief . */
+  std::size_t get_node_size() const
+    {
+      return sizeof(*this);
+    }
 #endif
 private:
   T *ptr_;
@@ -624,10 +1329,214 @@ private:
 }; // end class RCPNodeTmpl<T>
 
 
+/** \brief Allocate raw memory aligned to and padded up to a multiple of
+ * <tt>TEUCHOS_CACHE_LINE_SIZE</tt>.
+ *
+ * \relates RCPNode
+ */
+TEUCHOS_LIB_DLL_EXPORT void* allocateCacheLineAligned( std::size_t size );
+
+
+/** \brief Free memory from <tt>allocateCacheLineAligned()</tt>.
+ *
+ * \relates RCPNode
+ */
+TEUCHOS_LIB_DLL_EXPORT void deallocateCacheLineAligned( void* p );
+
+
+/** \brief Traits class that determines if the RCPNode objects for
+ * <tt>T</tt> are aligned to and padded up to a cache line.
+ *
+ * The reference counts of an object that is shared by several threads are
+ * written on every copy and destruction of an RCP.  If two such nodes end up
+ * in the same cache line, the threads working on different objects will
+ * still fight over that line (false sharing).  Specializing this class for a
+ * hot type gives each of its nodes its own cache lines, at the cost of extra
+ * memory per node.  Use the macro
+ * <tt>TEUCHOS_RCP_NODE_CACHE_LINE_ALIGNED(T)</tt> in the <tt>Teuchos</tt>
+ * namespace to do so.  See <tt>RCPNodeTracer::printFalseSharingCandidates()</tt>
+ * for finding such types.
+ *
+ * \ingroup teuchos_mem_mng_grp 
+ */
+template<class T>
+class RCPNodeCacheLineAligned {
+public:
+  /** \brief . */
+  static const bool value = false;
+};
+
+
+/** \brief Specialize <tt>RCPNodeCacheLineAligned</tt> to <tt>true</tt> for
+ * <tt>TYPE</tt>. */
+#define TEUCHOS_RCP_NODE_CACHE_LINE_ALIGNED(TYPE) \
+template<> \
+class RCPNodeCacheLineAligned<TYPE > { \
+public: \
+  static const bool value = true; \
+}
+
+
+/** \brief <tt>RCPNodeTmpl</tt> that is allocated on its own cache lines.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp 
+ */
+template<class T, class Dealloc_T>
+class RCPNodeTmplCacheLineAligned : public RCPNodeTmpl<T,Dealloc_T> {
+public:
+  /** \brief For defined types. */
+  RCPNodeTmplCacheLineAligned(T* p, Dealloc_T dealloc, bool has_ownership_in)
+    : RCPNodeTmpl<T,Dealloc_T>(p, TEUCHOS_MOVE(dealloc), has_ownership_in)
+    {}
+  /** \brief For undefined types . */
+  RCPNodeTmplCacheLineAligned(T* p, Dealloc_T dealloc, bool has_ownership_in,
+    ENull null_arg)
+    : RCPNodeTmpl<T,Dealloc_T>(p, TEUCHOS_MOVE(dealloc), has_ownership_in, null_arg)
+    {}
+  /** \brief . */
+  static void* operator new(std::size_t size)
+    { return allocateCacheLineAligned(size); }
+  /** \brief . */
+  static void operator delete(void* p)
+    { deallocateCacheLineAligned(p); }
+#ifdef TEUCHOS_DEBUG
+  /** \brief . */
+  std::size_t get_node_size() const
+    {
+      const std::size_t line = TEUCHOS_CACHE_LINE_SIZE;
+      return ((sizeof(*this) + line - 1) / line) * line;
+    }
+#endif
+private:
+  // Not defined and not to be called
+  RCPNodeTmplCacheLineAligned();
+  RCPNodeTmplCacheLineAligned(const RCPNodeTmplCacheLineAligned&);
+  RCPNodeTmplCacheLineAligned& operator=(const RCPNodeTmplCacheLineAligned&);
+};
+
+
+/** \brief Gives the concrete node type allocated for an RCP to a
+ * <tt>T</tt> object.
+ *
+ * This is not a general user-level class.
+ */
+template<class T, class Dealloc_T,
+  bool cacheLineAligned = RCPNodeCacheLineAligned<T>::value>
+class RCPNodeTmplType {
+public:
+  /** \brief . */
+  typedef RCPNodeTmpl<T,Dealloc_T> type;
+};
+
+
+/** \brief . */
+template<class T, class Dealloc_T>
+class RCPNodeTmplType<T,Dealloc_T,true> {
+public:
+  /** \brief . */
+  typedef RCPNodeTmplCacheLineAligned<T,Dealloc_T> type;
+};
+
+
+#ifdef HAVE_TEUCHOS_CXX11
+
+
+/** \brief Thread-local cache of raw memory blocks of <tt>Size</tt> bytes
+ * for RCPNode objects that are created and deleted at a high rate.
+ *
+ * A block freed on a thread is handed out again by the next allocation on
+ * that thread.  At most <tt>max_blocks_per_thread()</tt> blocks are kept per
+ * thread; any more go back to the heap.
+ *
+ * This is not a general user-level class.
+ */
+template<std::size_t Size>
+class RCPNodeBlockCache {
+public:
+  /** \brief . */
+  static void* allocate()
+    {
+      std::vector<void*> *blocks = local_blocks();
+      if (!blocks || blocks->empty())
+        return ::operator new(Size);
+      void *block = blocks->back();
+      blocks->pop_back();
+      return block;
+    }
+  /** \brief . */
+  static void deallocate(void* block)
+    {
+      std::vector<void*> *blocks = local_blocks();
+      if (blocks && blocks->size() < max_blocks_per_thread())
+        blocks->push_back(block);
+      else
+        ::operator delete(block);
+    }
+  /** \brief Make sure that at least <tt>numBlocks</tt> blocks are cached
+   * for the calling thread. */
+  static void reserve(std::size_t numBlocks)
+    {
+      std::vector<void*> *blocks = local_blocks();
+      while (blocks && blocks->size() < numBlocks)
+        blocks->push_back(::operator new(Size));
+    }
+  /** \brief . */
+  static std::size_t& max_blocks_per_thread()
+    {
+      static std::size_t s_max_blocks_per_thread = 1024;
+      return s_max_blocks_per_thread;
+    }
+private:
+  // Frees the cached blocks when the thread exits.  Nodes that are released
+  // later on during thread (or program) shutdown just go to the heap.
+  struct BlocksOwner {
+    ~BlocksOwner()
+      {
+        std::vector<void*> *&blocks = blocks_ptr();
+        for (std::size_t i = 0; i < blocks->size(); ++i)
+          ::operator delete((*blocks)[i]);
+        delete blocks;
+        blocks = 0;
+        blocks_destroyed() = true;
+      }
+  };
+  static std::vector<void*>*& blocks_ptr()
+    {
+      static thread_local std::vector<void*> *s_blocks = 0;
+      return s_blocks;
+    }
+  static bool& blocks_destroyed()
+    {
+      static thread_local bool s_blocks_destroyed = false;
+      return s_blocks_destroyed;
+    }
+  static std::vector<void*>* local_blocks()
+    {
+      std::vector<void*> *&blocks = blocks_ptr();
+      if (!blocks && !blocks_destroyed()) {
+        static thread_local BlocksOwner s_owner;
+        blocks = new std::vector<void*>;
+      }
+      return blocks;
+    }
+};
+
+
+#endif // HAVE_TEUCHOS_CXX11
+
+
 /** \brief Sets up node tracing and prints remaining RCPNodes on destruction.
  *
- * This class is used by automataic code that sets up support for RCPNode
- * tracing and for printing of remaining nodes on destruction.
+ * In a debug build, every translation unit that includes this header
+ * defines one instance before any of its own static objects (see below) and
+ * every RCPNodeHandle constructor calls setup(), which creates one more
+ * instance on demand for RCP objects created before that.  The active
+ * RCPNodes are printed when the last instance is destroyed, which is after
+ * all of the static objects that use RCP objects are destroyed.  In a
+ * release build there is no node tracing, nothing is created at all and
+ * there is no static initialization cost for including this header.
  *
  * \ingroup teuchos_mem_mng_grp
  */
@@ -637,16 +1546,36 @@ public:
   ActiveRCPNodesSetup();
   /** \brief . */
   ~ActiveRCPNodesSetup();
-  /** \brief . */
+  /** \brief Create the single program-wide instance if not already created.
+   *
+   * After the first call this is just an inline check of a flag.
+   */
+  static void setup()
+    {
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+      if (!is_setup_.load(std::memory_order_acquire))
+#else
+      if (!is_setup_)
+#endif
+        impl_setup();
+    }
+  /** \brief Deprecated (does nothing). */
   void foo();
 private:
   static int count_;
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  static std::atomic<bool> is_setup_;
+#else
+  static bool is_setup_;
+#endif
+  static void impl_setup();
 };
 
 
 } // namespace Teuchos
 
 
+#ifdef TEUCHOS_DEBUG
 namespace {
 // This static variable is delcared before all other static variables that
 // depend on RCP or other classes. Therefore, this static varaible will be
@@ -656,6 +1585,7 @@ namespace {
 // stream objects in many compiler implementations).
 Teuchos::ActiveRCPNodesSetup local_activeRCPNodesSetup;
 } // namespace
+#endif
 
 
 namespace Teuchos {
@@ -681,7 +1611,12 @@ public:
   /** \brief . */
   RCPNodeHandle(ENull null_arg = null)
     : node_(0), strength_(RCP_STRENGTH_INVALID)
-    {(void)null_arg;}
+    {
+      (void)null_arg;
+#ifdef TEUCHOS_DEBUG
+      ActiveRCPNodesSetup::setup();
+#endif
+    }
   /** \brief . */
   RCPNodeHandle( RCPNode* node, ERCPStrength strength_in = RCP_STRONG,
     bool newNode = true
@@ -689,6 +1624,7 @@ public:
     : node_(node), strength_(strength_in)
     {
 #ifdef TEUCHOS_DEBUG
+      ActiveRCPNodesSetup::setup();
       TEUCHOS_ASSERT(node);
 #endif
       bind();
@@ -714,6 +1650,7 @@ public:
     )
     : node_(node), strength_(strength_in)
     {
+      ActiveRCPNodesSetup::setup();
       TEUCHOS_ASSERT(strength_in == RCP_STRONG); // Can't handle weak yet!
       TEUCHOS_ASSERT(node_);
       bind();
@@ -732,6 +1669,16 @@ public:
     {
       bind();
     }
+#ifdef HAVE_TEUCHOS_CXX11
+  /** \brief Steal the node from <tt>node_ref</tt> without touching the
+   * reference counts. */
+  RCPNodeHandle(RCPNodeHandle&& node_ref) noexcept
+    : node_(node_ref.node_), strength_(node_ref.strength_)
+    {
+      node_ref.node_ = 0;
+      node_ref.strength_ = RCP_STRENGTH_INVALID;
+    }
+#endif
   /** \brief . */
   void swap( RCPNodeHandle& node_ref )
     {
@@ -774,11 +1721,38 @@ public:
       }
       return RCPNodeHandle();
     }
+  /** \brief Create a strong handle only if the object has not been deleted
+   * yet, otherwise return a null handle.
+   */
+  RCPNodeHandle create_strong_thread_safe() const
+    {
+      RCPNodeHandle strongHandle;
+      if (node_ && node_->incr_strong_count_if_nonzero()) {
+        // The count was already incremented so don't bind() again
+        strongHandle.node_ = node_;
+        strongHandle.strength_ = RCP_STRONG;
+      }
+      return strongHandle;
+    }
   /** \brief . */
   RCPNode* node_ptr() const
     {
       return node_;
     }
+  /** \brief Release the references held by <tt>n</tt> handles in one go
+   * and make them all null.
+   *
+   * With <tt>groupByNode==true</tt> the handles are first sorted by node so
+   * that all of the references to the same node are dropped with a single
+   * count update.  Otherwise, only handles to the same node that are next to
+   * each other are combined.  The last references to nodes are released in
+   * a second pass after all of the other counts have been updated.
+   *
+   * If deleting an object throws, the handles that were not released yet
+   * keep their references.
+   */
+  static void unbind_all( RCPNodeHandle* handles[], std::size_t n,
+    bool groupByNode = true );
   /** \brief . */
   bool is_node_null() const
     {
@@ -851,6 +1825,46 @@ public:
       debug_assert_not_null();
       node_->set_extra_data(extra_data, name, destroy_when, force_unique);
     }
+#ifdef HAVE_TEUCHOS_CXX11
+  /** \brief . */
+  void set_extra_data(
+    any &&extra_data, const std::string& name,
+    EPrePostDestruction destroy_when, bool force_unique
+    )
+    {
+      debug_assert_not_null();
+      node_->set_extra_data(std::move(extra_data), name, destroy_when,
+        force_unique);
+    }
+#endif
+  /** \brief . */
+  any& get_extra_data( const std::type_info& type, const std::string& name )
+    {
+      debug_assert_not_null();
+      return node_->get_extra_data(type, name);
+    }
+  /** \brief . */
+  const any& get_extra_data( const std::type_info& type,
+    const std::string& name
+    ) const
+    {
+      return const_cast<RCPNodeHandle*>(this)->get_extra_data(type, name);
+    }
+  /** \brief . */
+  any* get_optional_extra_data( const std::type_info& type,
+    const std::string& name
+    )
+    {
+      debug_assert_not_null();
+      return node_->get_optional_extra_data(type, name);
+    }
+  /** \brief . */
+  const any* get_optional_extra_data( const std::type_info& type,
+    const std::string& name
+    ) const
+    {
+      return const_cast<RCPNodeHandle*>(this)->get_optional_extra_data(type, name);
+    }
   /** \brief . */
   any& get_extra_data( const std::string& type_name,
     const std::string& name
@@ -927,12 +1941,11 @@ private:
   inline void unbind() 
     {
       // Optimize this implementation for count > 1
-      if (node_ && node_->deincr_count(strength_)==0) {
-        // If we get here, the reference count has gone to 0 and something
-        // interesting is going to happen.  In this case, we need to
-        // reincrement the count back to 1 and call the more complex function
-        // that will either delete the object or delete the node.
-        node_->incr_count(strength_);
+      if (node_ && !node_->deincr_count_if_not_last(strength_)) {
+        // If we get here, this is the last strong reference or the last
+        // reference of any kind and something interesting is going to happen.
+        // The count has not been changed and the more complex function will
+        // either delete the object or delete the node.
         unbindOne();
       }
       // If we get here, either node_==0 or the count is still greater than 0.
@@ -972,15 +1985,18 @@ public:
   /** \brief Called with node_!=0 when an exception is thrown.
    *
    * When an exception is not thrown, the client should have called release()
-   * before this function is called.
+   * before this function is called.  Without exceptions an error aborts the
+   * program, so there is never anything to clean up here.
    */
   ~RCPNodeThrowDeleter()
     {
+#ifndef TEUCHOS_NO_EXCEPTIONS
       if (node_) {
         node_->has_ownership(false); // Avoid actually deleting ptr_
         node_->delete_obj(); // Sets the pointer ptr_=0 to allow RCPNode delete
         delete node_;
       }
+#endif
     }
   /** \brief . */
   RCPNode* get() const
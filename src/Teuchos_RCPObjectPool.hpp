@@ -0,0 +1,588 @@
+// @HEADER
+// ***********************************************************************
+// 
+//                    Teuchos: Common Tools Package
+//                 Copyright (2004) Sandia Corporation
+// 
+// Under terms of Contract DE-AC04-94AL85000, there is a non-exclusive
+// license for use of this work by or on behalf of the U.S. Government.
+// 
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as
+// published by the Free Software Foundation; either version 2.1 of the
+// License, or (at your option) any later version.
+//  
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//  
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+// Questions? Contact Michael A. Heroux (maherou@sandia.gov) 
+// 
+// ***********************************************************************
+// @HEADER
+
+#ifndef TEUCHOS_RCP_OBJECT_POOL_HPP
+#define TEUCHOS_RCP_OBJECT_POOL_HPP
+
+
+/** \file Teuchos_RCPObjectPool.hpp
+ *
+ * \brief Pool of objects handed out as <tt>RCP</tt>s that are recycled
+ * instead of deleted.
+ */
+
+
+#include "Teuchos_RCP.hpp"
+
+#ifndef HAVE_TEUCHOS_CXX11
+#  error "Teuchos_RCPObjectPool.hpp requires a C++11 compiler"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+
+namespace Teuchos {
+
+
+/** \brief Default reset policy for <tt>RCPObjectPool</tt> that leaves a
+ * returned object as it is.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T>
+class RCPObjectPoolNoReset {
+public:
+  /** \brief . */
+  void operator()(T&) const {}
+};
+
+
+template<class T, class Reset_T> class RCPObjectPoolState;
+
+
+/** \brief Deallocator policy class that returns an object to its
+ * <tt>RCPObjectPool</tt>.
+ *
+ * Each object handed out holds a reference to the pool's shared state so
+ * the state lives until all of its objects have been returned.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T, class Reset_T>
+class RCPObjectPoolDealloc
+{
+public:
+  /** \brief . */
+  typedef T ptr_t;
+  /** \brief . */
+  explicit RCPObjectPoolDealloc(RCPObjectPoolState<T,Reset_T> *state)
+    : state_(state)
+    {}
+  /** \brief Reset the object and return it to the pool. */
+  void free( T* ptr ) { if (ptr) state_->release(ptr); }
+private:
+  RCPObjectPoolState<T,Reset_T> *state_;
+};
+
+
+/** \brief Node class for pooled objects.
+ *
+ * The node memory is recycled through <tt>RCPNodeBlockCache</tt>.  A traced
+ * node is keyed by its object's address like any other node (so
+ * <tt>rcpFromRef()</tt> to a pooled object finds it in a debug build).  The
+ * node is untraced when its object is returned to the pool so it never
+ * clashes with the node of the object's next use.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T, class Reset_T>
+class RCPObjectPoolNodeTmpl
+  : public RCPNodeTmpl<T, RCPObjectPoolDealloc<T,Reset_T> >
+{
+public:
+  /** \brief . */
+  typedef RCPObjectPoolDealloc<T,Reset_T> dealloc_t;
+  /** \brief . */
+  RCPObjectPoolNodeTmpl(T* p, dealloc_t dealloc, bool has_ownership_in)
+    : RCPNodeTmpl<T,dealloc_t>(p, TEUCHOS_MOVE(dealloc), has_ownership_in)
+    {}
+  /** \brief . */
+  RCPObjectPoolNodeTmpl(T* p, dealloc_t dealloc, bool has_ownership_in,
+    ENull null_arg)
+    : RCPNodeTmpl<T,dealloc_t>(p, TEUCHOS_MOVE(dealloc), has_ownership_in, null_arg)
+    {}
+  /** \brief . */
+  static void* operator new(std::size_t size)
+    {
+      TEUCHOS_ASSERT_EQUALITY(size, sizeof(RCPObjectPoolNodeTmpl));
+      return RCPNodeBlockCache<sizeof(RCPObjectPoolNodeTmpl)>::allocate();
+    }
+  /** \brief . */
+  static void operator delete(void* p)
+    { RCPNodeBlockCache<sizeof(RCPObjectPoolNodeTmpl)>::deallocate(p); }
+#ifdef TEUCHOS_DEBUG
+  /** \brief . */
+  std::size_t get_node_size() const
+    {
+      return sizeof(*this);
+    }
+#endif
+private:
+  // Not defined and not to be called
+  RCPObjectPoolNodeTmpl();
+  RCPObjectPoolNodeTmpl(const RCPObjectPoolNodeTmpl&);
+  RCPObjectPoolNodeTmpl& operator=(const RCPObjectPoolNodeTmpl&);
+};
+
+
+/** \brief . */
+template<class T, class Reset_T>
+class RCPNodeTmplType<T, RCPObjectPoolDealloc<T,Reset_T>, false> {
+public:
+  /** \brief . */
+  typedef RCPObjectPoolNodeTmpl<T,Reset_T> type;
+};
+
+
+/** \brief . */
+template<class T, class Reset_T>
+class RCPNodeTmplType<T, RCPObjectPoolDealloc<T,Reset_T>, true> {
+public:
+  /** \brief . */
+  typedef RCPObjectPoolNodeTmpl<T,Reset_T> type;
+};
+
+
+/** \brief Statistics of an <tt>RCPObjectPool</tt>.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+struct RCPObjectPoolStatistics {
+  RCPObjectPoolStatistics()
+    : numHits(0), numMisses(0), numReleases(0), numDiscards(0)
+    {}
+  /** \brief Number of objects handed out that came from the pool. */
+  long int numHits;
+  /** \brief Number of objects handed out that had to be created. */
+  long int numMisses;
+  /** \brief Number of objects returned to the pool. */
+  long int numReleases;
+  /** \brief Number of returned objects that were deleted because the
+   * returning thread and the shared list already had the maximum number
+   * cached. */
+  long int numDiscards;
+};
+
+
+/** \brief Shared state of an <tt>RCPObjectPool</tt>.
+ *
+ * The state counts its references by hand: the pool holds one and every
+ * object that is handed out holds one until it comes back.  That count is
+ * the only read-modify-write per acquire and release; the statistics are
+ * kept per thread and only written by their own thread.
+ *
+ * This is not a general user-level class.
+ */
+template<class T, class Reset_T>
+class RCPObjectPoolState {
+public:
+  /** \brief . */
+  RCPObjectPoolState(const Reset_T &reset, std::size_t maxCachedPerThread)
+    : id_(allocate_id()), serial_(++last_serial()), reset_(reset),
+      maxCachedPerThread_(maxCachedPerThread), numRefs_(1)
+    {}
+  /** \brief Deletes all of the cached objects. */
+  ~RCPObjectPoolState()
+    {
+      for (std::size_t i = 0; i < locals_.size(); ++i) {
+        free_list_t &list = locals_[i]->list;
+        for (std::size_t j = 0; j < list.size(); ++j)
+          delete list[j];
+        delete locals_[i];
+      }
+      for (std::size_t j = 0; j < shared_list_.size(); ++j)
+        delete shared_list_[j];
+      free_id(id_);
+    }
+  /** \brief Give up one reference, deleting the state with the last one. */
+  void remove_ref()
+    {
+      if (numRefs_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete this;
+    }
+  /** \brief Get an object from the calling thread's list (refilled from the
+   * shared list if empty) or create one.  The object holds a reference to
+   * the state until it is released. */
+  T* acquire()
+    {
+      local_t *local = this->local();
+      free_list_t *list = local ? &local->list : 0;
+      T *p = 0;
+      if (list && !list->empty()) {
+        p = list->back();
+        list->pop_back();
+      }
+      else {
+        p = take_shared(list);
+      }
+      if (p) {
+        incr(local, &counts_t::numHits);
+      }
+      else {
+        p = new T();
+        incr(local, &counts_t::numMisses);
+      }
+      numRefs_.fetch_add(1, std::memory_order_relaxed);
+      return p;
+    }
+  /** \brief Reset the object and put it on the calling thread's list (or
+   * on the shared list if that is full), then give up its reference. */
+  void release(T* p)
+    {
+      local_t *local = this->local();
+      free_list_t *list = local ? &local->list : 0;
+      incr(local, &counts_t::numReleases);
+      reset_(*p);
+      if (list && list->size() < maxCachedPerThread_) {
+        list->push_back(p);
+      }
+      else if (!give_shared(p, list)) {
+        incr(local, &counts_t::numDiscards);
+        delete p;
+      }
+      remove_ref();
+    }
+  /** \brief Create objects on the calling thread's list up to
+   * <tt>numObjects</tt>. */
+  void reserve(std::size_t numObjects)
+    {
+      local_t *local = this->local();
+      while (local && local->list.size() < numObjects)
+        local->list.push_back(new T());
+    }
+  /** \brief . */
+  RCPObjectPoolStatistics getStatistics()
+    {
+      RCPObjectPoolStatistics stats;
+      add_counts(stats, shared_counts_);
+      std::lock_guard<std::mutex> lock(locals_mutex_);
+      for (std::size_t i = 0; i < locals_.size(); ++i)
+        add_counts(stats, locals_[i]->counts);
+      return stats;
+    }
+private:
+  typedef std::vector<T*> free_list_t;
+  struct counts_t {
+    counts_t() : numHits(0), numMisses(0), numReleases(0), numDiscards(0) {}
+    std::atomic<long int> numHits;
+    std::atomic<long int> numMisses;
+    std::atomic<long int> numReleases;
+    std::atomic<long int> numDiscards;
+  };
+  // A thread's list and statistics, owned by the pool
+  struct local_t {
+    free_list_t list;
+    counts_t counts;
+  };
+  const std::size_t id_;
+  const std::size_t serial_;
+  Reset_T reset_;
+  const std::size_t maxCachedPerThread_;
+  std::atomic<long int> numRefs_;
+  counts_t shared_counts_; // Counts of threads without a list
+  std::mutex locals_mutex_;
+  std::vector<local_t*> locals_; // All of the threads' lists
+  // Objects passed on from threads that release more than they acquire to
+  // threads that acquire more than they release.  They are moved in batches
+  // of half a thread's list so the lock is taken rarely.
+  std::mutex shared_list_mutex_;
+  free_list_t shared_list_;
+  // A thread's own count is only written by that thread so a plain load and
+  // store will do; getStatistics() may read it at any time.
+  void incr(local_t *local, std::atomic<long int> counts_t::*count)
+    {
+      if (local) {
+        std::atomic<long int> &c = local->counts.*count;
+        c.store(c.load(std::memory_order_relaxed) + 1,
+          std::memory_order_relaxed);
+      }
+      else {
+        (shared_counts_.*count).fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  static void add_counts(RCPObjectPoolStatistics &stats, const counts_t &counts)
+    {
+      stats.numHits += counts.numHits.load(std::memory_order_relaxed);
+      stats.numMisses += counts.numMisses.load(std::memory_order_relaxed);
+      stats.numReleases += counts.numReleases.load(std::memory_order_relaxed);
+      stats.numDiscards += counts.numDiscards.load(std::memory_order_relaxed);
+    }
+  std::size_t batch_size() const
+    {
+      return maxCachedPerThread_ / 2 + 1;
+    }
+  // Put p and up to a batch from the full list on the shared list
+  bool give_shared(T* p, free_list_t *list)
+    {
+      std::lock_guard<std::mutex> lock(shared_list_mutex_);
+      if (shared_list_.size() >= maxCachedPerThread_)
+        return false;
+      shared_list_.push_back(p);
+      if (list) {
+        const std::size_t numMoved = std::min(
+          std::min(batch_size() - 1, list->size()),
+          maxCachedPerThread_ - shared_list_.size());
+        shared_list_.insert(shared_list_.end(), list->end() - numMoved,
+          list->end());
+        list->resize(list->size() - numMoved);
+      }
+      return true;
+    }
+  // Take one object and refill the empty list with up to a batch more
+  T* take_shared(free_list_t *list)
+    {
+      std::lock_guard<std::mutex> lock(shared_list_mutex_);
+      if (shared_list_.empty())
+        return 0;
+      T *p = shared_list_.back();
+      shared_list_.pop_back();
+      if (list) {
+        const std::size_t numMoved =
+          std::min(batch_size() - 1, shared_list_.size());
+        list->insert(list->end(), shared_list_.end() - numMoved,
+          shared_list_.end());
+        shared_list_.resize(shared_list_.size() - numMoved);
+      }
+      return p;
+    }
+  // Ids index the threads' tables and are reused once their pool is gone,
+  // so a table is only as long as the most pools that ever lived at once.
+  // An entry left behind by a destroyed pool is told apart from the entry of
+  // the next pool with the same id by the pool's serial number, which is
+  // never reused.
+  static std::mutex& ids_mutex()
+    {
+      static std::mutex *s_mutex = new std::mutex;
+      return *s_mutex;
+    }
+  static std::vector<std::size_t>& free_ids()
+    {
+      static std::vector<std::size_t> *s_free_ids = new std::vector<std::size_t>;
+      return *s_free_ids;
+    }
+  static std::size_t allocate_id()
+    {
+      static std::size_t s_num_ids = 0;
+      std::lock_guard<std::mutex> lock(ids_mutex());
+      std::vector<std::size_t> &ids = free_ids();
+      if (ids.empty())
+        return s_num_ids++;
+      const std::size_t id = ids.back();
+      ids.pop_back();
+      return id;
+    }
+  static void free_id(std::size_t id)
+    {
+      std::lock_guard<std::mutex> lock(ids_mutex());
+      free_ids().push_back(id);
+    }
+  static std::atomic<std::size_t>& last_serial()
+    {
+      static std::atomic<std::size_t> s_last_serial(0);
+      return s_last_serial;
+    }
+  // Table of the calling thread's lists indexed by pool id.  The lists
+  // themselves are owned by their pools.  Objects released during thread (or
+  // program) shutdown after the table is gone are simply deleted.
+  struct table_entry_t {
+    table_entry_t() : serial(0), local(0) {}
+    std::size_t serial;
+    local_t *local;
+  };
+  typedef std::vector<table_entry_t> table_t;
+  struct TableOwner {
+    ~TableOwner()
+      {
+        delete table_ptr();
+        table_ptr() = 0;
+        table_destroyed() = true;
+      }
+  };
+  static table_t*& table_ptr()
+    {
+      static thread_local table_t *s_table = 0;
+      return s_table;
+    }
+  static bool& table_destroyed()
+    {
+      static thread_local bool s_table_destroyed = false;
+      return s_table_destroyed;
+    }
+  local_t* local()
+    {
+      table_t *&table = table_ptr();
+      if (!table) {
+        if (table_destroyed())
+          return 0;
+        static thread_local TableOwner s_owner;
+        table = new table_t;
+      }
+      if (table->size() <= id_)
+        table->resize(id_ + 1);
+      table_entry_t &entry = (*table)[id_];
+      if (entry.serial != serial_) {
+        local_t *local = new local_t;
+        {
+          std::lock_guard<std::mutex> lock(locals_mutex_);
+          locals_.push_back(local);
+        }
+        entry.serial = serial_;
+        entry.local = local;
+      }
+      return entry.local;
+    }
+  // Not defined and not to be called
+  RCPObjectPoolState(const RCPObjectPoolState&);
+  RCPObjectPoolState& operator=(const RCPObjectPoolState&);
+};
+
+
+/** \brief Pool of objects that are handed out as <tt>RCP<T></tt> objects
+ * and recycled instead of deleted.
+ *
+ * When the last strong RCP to a pooled object goes away, the object is
+ * reset with <tt>Reset_T</tt> and put back on a free list of the thread
+ * that released it.  The next <tt>acquire()</tt> on that thread gets it
+ * back without calling a constructor or allocating any memory: the RCP
+ * nodes of pooled objects are recycled through a thread-local cache as
+ * well.
+
+ \code
+  struct ClearMessage {
+    void operator()(Message &msg) const { msg.clear(); }
+  };
+
+  RCPObjectPool<Message, ClearMessage> messagePool(1000);
+
+  RCP<Message> msg = messagePool.acquire();
+  ...
+  msg = null; // msg is cleared and back in the pool
+ \endcode
+
+ * <tt>T</tt> must be default constructible.  The free lists are per thread
+ * and lock free; objects released on one thread are reused on that thread.
+ * At most <tt>maxCachedPerThread</tt> objects are kept per thread.  When a
+ * thread's list is full, half of it is moved to a locked list shared by all
+ * threads (which holds at most <tt>maxCachedPerThread</tt> objects as well;
+ * any more are deleted), and a thread with an empty list refills it from
+ * there.  That way objects released by a consumer thread are reused by the
+ * producer thread.  Objects cached by a thread that exits stay in the pool
+ * until the pool is destroyed.
+ *
+ * Destroying the pool is fine even if some of its objects are still in
+ * use: the pool's shared state (and with it all of the cached objects) is
+ * deleted when the last object has been returned.
+ *
+ * <b>Warning!</b> Handing out pooled objects on several threads requires
+ * Teuchos to be configured with <tt>TEUCHOS_ENABLE_THREAD_SAFE=ON</tt>.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T, class Reset_T = RCPObjectPoolNoReset<T> >
+class RCPObjectPool {
+public:
+
+  /** \brief . */
+  typedef RCPObjectPoolState<T,Reset_T> state_t;
+  /** \brief . */
+  typedef RCPObjectPoolDealloc<T,Reset_T> dealloc_t;
+
+  /** \brief Create the pool and pre-allocate <tt>initialSize</tt> objects
+   * and nodes for the calling thread. */
+  explicit RCPObjectPool(std::size_t initialSize = 0,
+    const Reset_T &reset = Reset_T(), std::size_t maxCachedPerThread = 1024)
+    : state_(new state_t(reset, maxCachedPerThread))
+    {
+      TEUCHOS_TRY {
+        reserve(initialSize);
+      }
+      TEUCHOS_CATCH_ALL {
+        state_->remove_ref();
+        TEUCHOS_RETHROW;
+      }
+    }
+
+  /** \brief The cached objects are deleted along with the pool's shared
+   * state once the last object that is still in use has been returned. */
+  ~RCPObjectPool()
+    {
+      state_->remove_ref();
+    }
+
+  /** \brief Get an object from the pool. */
+  RCP<T> acquire() const
+    {
+      T *p = state_->acquire();
+      TEUCHOS_TRY {
+        return rcpWithDealloc(p, dealloc_t(state_));
+      }
+      TEUCHOS_CATCH_ALL {
+        state_->release(p);
+        TEUCHOS_RETHROW;
+      }
+    }
+
+  /** \brief Pre-allocate objects and nodes for the calling thread up to
+   * <tt>numObjects</tt>. */
+  void reserve(std::size_t numObjects) const
+    {
+      state_->reserve(numObjects);
+      RCPNodeBlockCache<sizeof(RCPObjectPoolNodeTmpl<T,Reset_T>)>::reserve(
+        numObjects);
+    }
+
+  /** \brief . */
+  RCPObjectPoolStatistics getStatistics() const
+    {
+      return state_->getStatistics();
+    }
+
+private:
+
+  state_t *state_;
+
+  // Not defined and not to be called
+  RCPObjectPool(const RCPObjectPool&);
+  RCPObjectPool& operator=(const RCPObjectPool&);
+
+};
+
+
+/** \brief Print the statistics of an <tt>RCPObjectPool</tt>.
+ *
+ * \relates RCPObjectPool
+ */
+inline
+std::ostream& operator<<(std::ostream& out, const RCPObjectPoolStatistics &stats)
+{
+  return out
+    << "{numHits="<<stats.numHits<<", numMisses="<<stats.numMisses
+    << ", numReleases="<<stats.numReleases
+    << ", numDiscards="<<stats.numDiscards<<"}";
+}
+
+
+} // namespace Teuchos
+
+
+#endif // TEUCHOS_RCP_OBJECT_POOL_HPP
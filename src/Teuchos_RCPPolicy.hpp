@@ -0,0 +1,639 @@
+// @HEADER
+// ***********************************************************************
+// 
+//                    Teuchos: Common Tools Package
+//                 Copyright (2004) Sandia Corporation
+// 
+// Under terms of Contract DE-AC04-94AL85000, there is a non-exclusive
+// license for use of this work by or on behalf of the U.S. Government.
+// 
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as
+// published by the Free Software Foundation; either version 2.1 of the
+// License, or (at your option) any later version.
+//  
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//  
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+// Questions? Contact Michael A. Heroux (maherou@sandia.gov) 
+// 
+// ***********************************************************************
+// @HEADER
+
+#ifndef TEUCHOS_RCP_POLICY_HPP
+#define TEUCHOS_RCP_POLICY_HPP
+
+
+/*! \file Teuchos_RCPPolicy.hpp
+    \brief Reference-counted pointer class with compile-time selected features
+    and its non-member templated function implementations.
+*/
+
+
+#include "Teuchos_RCPPolicyDecl.hpp"
+#include "Teuchos_RCP.hpp"
+
+
+namespace Teuchos {
+
+
+// very bad public functions
+
+
+template<class T, class Policy, class Dealloc_T>
+inline
+typename RCP<T,Policy>::node_t*
+RCP_createNewPolicyNode( T* p, Dealloc_T dealloc )
+{
+  typedef typename RCP<T,Policy>::node_t node_t;
+  node_t *node = new RCPPolicyNodeTmpl<T,Dealloc_T,node_t>(p, TEUCHOS_MOVE(dealloc));
+#ifdef TEUCHOS_DEBUG
+  if (Policy::has_tracing_support && p && RCPNodeTracer::isTracingActiveRCPNodes()) {
+    std::ostringstream os;
+    os << "{T="<<TypeNameTraits<T>::name()<<", Policy="
+       << TypeNameTraits<Policy>::name()<<", Dealloc_T="
+       << TypeNameTraits<Dealloc_T>::name()<<"}";
+    node->set_traced(RCPNodeTracer::addNewPolicyRCPNode(node, os.str()));
+  }
+#endif
+  return node;
+}
+
+
+} // namespace Teuchos
+
+
+// Constructors/destructors/initializers
+
+
+template<class T, class Policy>
+inline
+Teuchos::RCP<T,Policy>::RCP( ENull )
+  : ptr_(NULL)
+{}
+
+
+template<class T, class Policy>
+inline
+Teuchos::RCP<T,Policy>::RCP( T* p, bool has_ownership_in )
+  : ptr_(p)
+{
+  if (p) {
+    node_t *node = ( has_ownership_in
+      ? RCP_createNewPolicyNode<T,Policy>(p, DeallocDelete<T>())
+      : RCP_createNewPolicyNode<T,Policy>(p, DeallocNull<T>()) );
+    node_handle_t(node).swap(node_);
+  }
+}
+
+
+template<class T, class Policy>
+template<class Dealloc_T>
+inline
+Teuchos::RCP<T,Policy>::RCP( T* p, Dealloc_T dealloc )
+  : ptr_(p)
+{
+  if (p) {
+    node_handle_t(RCP_createNewPolicyNode<T,Policy>(p, TEUCHOS_MOVE(dealloc))).swap(node_);
+  }
+}
+
+
+template<class T, class Policy>
+inline
+Teuchos::RCP<T,Policy>::RCP(const RCP<T,Policy>& r_ptr)
+  : ptr_(r_ptr.ptr_), node_(r_ptr.node_)
+{}
+
+
+template<class T, class Policy>
+template<class T2, class Policy2>
+inline
+Teuchos::RCP<T,Policy>::RCP(const RCP<T2,Policy2>& r_ptr)
+  : ptr_(r_ptr.get()), // will not compile if T is not base class of T2
+    node_(r_ptr.access_private_node())
+{
+  // Will not compile if the policies do not share the same node type
+  (void)sizeof(RCPPolicyAssertFeature<
+    RCPPolicyCompatible<Policy2,Policy>::value>);
+}
+
+
+template<class T, class Policy>
+inline
+Teuchos::RCP<T,Policy>::~RCP()
+{}
+
+
+template<class T, class Policy>
+inline
+Teuchos::RCP<T,Policy>&
+Teuchos::RCP<T,Policy>::operator=(const RCP<T,Policy>& r_ptr)
+{
+  if (this == &r_ptr)
+    return *this;
+  node_ = r_ptr.access_private_node(); // May throw in debug mode!
+  ptr_ = r_ptr.ptr_;
+  return *this;
+}
+
+
+template<class T, class Policy>
+inline
+Teuchos::RCP<T,Policy>& Teuchos::RCP<T,Policy>::operator=(ENull)
+{
+  reset();
+  return *this;
+}
+
+
+template<class T, class Policy>
+inline
+void Teuchos::RCP<T,Policy>::swap(RCP<T,Policy> &r_ptr)
+{
+  std::swap(r_ptr.ptr_, ptr_);
+  node_.swap(r_ptr.node_);
+}
+
+
+// Object query and access functions
+
+
+template<class T, class Policy>
+inline
+bool Teuchos::RCP<T,Policy>::is_null() const
+{
+  return ptr_ == 0;
+}
+
+
+template<class T, class Policy>
+inline
+T* Teuchos::RCP<T,Policy>::operator->() const
+{
+  debug_assert_not_null();
+  debug_assert_valid_ptr();
+  return ptr_;
+}
+
+
+template<class T, class Policy>
+inline
+T& Teuchos::RCP<T,Policy>::operator*() const
+{
+  debug_assert_not_null();
+  debug_assert_valid_ptr();
+  return *ptr_;
+}
+
+
+template<class T, class Policy>
+inline
+T* Teuchos::RCP<T,Policy>::get() const
+{
+  debug_assert_valid_ptr();
+  return ptr_;
+}
+
+
+template<class T, class Policy>
+inline
+T* Teuchos::RCP<T,Policy>::getRawPtr() const
+{
+  return this->get();
+}
+
+
+// Reference counting
+
+
+template<class T, class Policy>
+inline
+Teuchos::ERCPStrength Teuchos::RCP<T,Policy>::strength() const
+{
+  return node_.strength();
+}
+
+
+template<class T, class Policy>
+inline
+bool Teuchos::RCP<T,Policy>::is_valid_ptr() const
+{
+  if (ptr_)
+    return node_.is_valid_ptr();
+  return true;
+}
+
+
+template<class T, class Policy>
+inline
+int Teuchos::RCP<T,Policy>::strong_count() const
+{
+  return node_.strong_count();
+}
+
+
+template<class T, class Policy>
+inline
+int Teuchos::RCP<T,Policy>::weak_count() const
+{
+  return node_.weak_count();
+}
+
+
+template<class T, class Policy>
+inline
+int Teuchos::RCP<T,Policy>::total_count() const
+{
+  return node_.strong_count() + node_.weak_count();
+}
+
+
+template<class T, class Policy>
+inline
+Teuchos::RCP<T,Policy> Teuchos::RCP<T,Policy>::create_weak() const
+{
+  (void)sizeof(RCPPolicyAssertFeature<Policy::has_weak_support>);
+  debug_assert_valid_ptr();
+  return RCP<T,Policy>(ptr_, node_.create_weak());
+}
+
+
+template<class T, class Policy>
+inline
+Teuchos::RCP<T,Policy> Teuchos::RCP<T,Policy>::create_strong() const
+{
+  (void)sizeof(RCPPolicyAssertFeature<Policy::has_weak_support>);
+  node_handle_t strongNode = node_.create_strong();
+  if (strongNode.node_ptr())
+    return RCP<T,Policy>(ptr_, strongNode);
+  return null;
+}
+
+
+template<class T, class Policy>
+template <class T2, class Policy2>
+inline
+bool Teuchos::RCP<T,Policy>::shares_resource(const RCP<T2,Policy2>& r_ptr) const
+{
+  return static_cast<const void*>(node_.node_ptr())
+    == static_cast<const void*>(r_ptr.access_private_node().node_ptr());
+}
+
+
+// Assertions
+
+
+template<class T, class Policy>
+inline
+const Teuchos::RCP<T,Policy>& Teuchos::RCP<T,Policy>::assert_not_null() const
+{
+  if (!ptr_)
+    throw_null_ptr_error(typeName(*this));
+  return *this;
+}
+
+
+template<class T, class Policy>
+inline
+const Teuchos::RCP<T,Policy>& Teuchos::RCP<T,Policy>::assert_valid_ptr() const
+{
+  TEST_FOR_EXCEPTION( !is_valid_ptr(), DanglingReferenceError,
+    "Error, an attempt has been made to dereference the underlying object\n"
+    "from a weak smart pointer object where the underling object has already\n"
+    "been deleted since the strong count has already gone to zero.\n"
+    "\n"
+    "Context information:\n"
+    "\n"
+    "  RCP type:             " << typeName(*this) << "\n"
+    "  RCP address:          " << this << "\n"
+    "  RCPPolicyNode address: " << node_.node_ptr() << "\n"
+    "  RCP ptr address:      " << ptr_ << "\n"
+    );
+  return *this;
+}
+
+
+// boost::shared_ptr compatiblity funtions
+
+
+template<class T, class Policy>
+inline
+void Teuchos::RCP<T,Policy>::reset()
+{
+  node_handle_t().swap(node_);
+  ptr_ = 0;
+}
+
+
+template<class T, class Policy>
+inline
+int Teuchos::RCP<T,Policy>::count() const
+{
+  return node_.strong_count();
+}
+
+
+// very bad public functions
+
+
+template<class T, class Policy>
+inline
+Teuchos::RCP<T,Policy>::RCP( T* p, const node_handle_t& node)
+  : ptr_(p), node_(node)
+{}
+
+
+template<class T, class Policy>
+inline
+T* Teuchos::RCP<T,Policy>::access_private_ptr() const
+{  return ptr_; }
+
+
+template<class T, class Policy>
+inline
+typename Teuchos::RCP<T,Policy>::node_handle_t&
+Teuchos::RCP<T,Policy>::nonconst_access_private_node()
+{  return node_; }
+
+
+template<class T, class Policy>
+inline
+const typename Teuchos::RCP<T,Policy>::node_handle_t&
+Teuchos::RCP<T,Policy>::access_private_node() const
+{  return node_; }
+
+
+// Non-member functions
+
+
+template<class Policy, class T>
+inline
+Teuchos::RCP<T,Policy>
+Teuchos::rcpWithPolicy( T* p, bool owns_mem )
+{
+  return RCP<T,Policy>(p, owns_mem);
+}
+
+
+template<class Policy, class T, class Dealloc_T>
+inline
+Teuchos::RCP<T,Policy>
+Teuchos::rcpWithPolicyAndDealloc( T* p, Dealloc_T dealloc )
+{
+  return RCP<T,Policy>(p, TEUCHOS_MOVE(dealloc));
+}
+
+
+template<class Policy, class T>
+Teuchos::RCP<T,Policy>
+Teuchos::rcpWithPolicy( const RCP<T> &p )
+{
+  if (is_null(p))
+    return null;
+  return RCP<T,Policy>(p.get(),
+    EmbeddedObjDealloc<T,RCP<T>,DeallocNull<T> >(
+      p, POST_DESTROY, DeallocNull<T>()));
+}
+
+
+template<class T, class Policy>
+Teuchos::RCP<T>
+Teuchos::rcpWithDefaultPolicy( const RCP<T,Policy> &p )
+{
+  if (is_null(p))
+    return null;
+  return rcpWithEmbeddedObj(p.get(), p, false);
+}
+
+
+template<class T, class Policy>
+inline
+bool Teuchos::is_null( const RCP<T,Policy> &p )
+{
+  return p.is_null();
+}
+
+
+template<class T, class Policy>
+inline
+bool Teuchos::nonnull( const RCP<T,Policy> &p )
+{
+  return !p.is_null();
+}
+
+
+template<class T, class Policy>
+inline
+bool Teuchos::operator==( const RCP<T,Policy> &p, ENull )
+{
+  return p.get() == NULL;
+}
+
+
+template<class T, class Policy>
+inline
+bool Teuchos::operator!=( const RCP<T,Policy> &p, ENull )
+{
+  return p.get() != NULL;
+}
+
+
+template<class T1, class T2, class Policy>
+inline
+bool Teuchos::operator==( const RCP<T1,Policy> &p1, const RCP<T2,Policy> &p2 )
+{
+  return p1.access_private_node().same_node(p2.access_private_node());
+}
+
+
+template<class T1, class T2, class Policy>
+inline
+bool Teuchos::operator!=( const RCP<T1,Policy> &p1, const RCP<T2,Policy> &p2 )
+{
+  return !p1.access_private_node().same_node(p2.access_private_node());
+}
+
+
+template<class T2, class T1, class Policy>
+inline
+Teuchos::RCP<T2,Policy>
+Teuchos::rcp_implicit_cast(const RCP<T1,Policy>& p1)
+{
+  // Make the compiler check if the conversion is legal
+  T2 *check = p1.get();
+  return RCP<T2,Policy>(check, p1.access_private_node());
+}
+
+
+template<class T2, class T1, class Policy>
+inline
+Teuchos::RCP<T2,Policy>
+Teuchos::rcp_static_cast(const RCP<T1,Policy>& p1)
+{
+  // Make the compiler check if the conversion is legal
+  T2 *check = static_cast<T2*>(p1.get());
+  return RCP<T2,Policy>(check, p1.access_private_node());
+}
+
+
+template<class T2, class T1, class Policy>
+inline
+Teuchos::RCP<T2,Policy>
+Teuchos::rcp_const_cast(const RCP<T1,Policy>& p1)
+{
+  // Make the compiler check if the conversion is legal
+  T2 *check = const_cast<T2*>(p1.get());
+  return RCP<T2,Policy>(check, p1.access_private_node());
+}
+
+
+template<class T2, class T1, class Policy>
+inline
+Teuchos::RCP<T2,Policy>
+Teuchos::rcp_dynamic_cast(const RCP<T1,Policy>& p1, bool throw_on_fail)
+{
+  if (!is_null(p1)) {
+    T2 *p = NULL;
+    if (throw_on_fail) {
+      p = &dyn_cast<T2>(*p1);
+    }
+    else {
+      // Make the compiler check if the conversion is legal
+      p = dyn_cast_ptr<T2>(p1.get());
+    }
+    if (p) {
+      return RCP<T2,Policy>(p, p1.access_private_node());
+    }
+  }
+  return null;
+}
+
+
+template<class T1, class T2, class Policy>
+inline
+void Teuchos::set_extra_data( const T1 &extra_data, const std::string& name,
+  const Ptr<RCP<T2,Policy> > &p, EPrePostDestruction destroy_when,
+  bool force_unique )
+{
+  (void)sizeof(RCPPolicyAssertFeature<Policy::has_extra_data_support>);
+  p->assert_not_null();
+  p->access_private_node().node_ptr()->extra_data().set_extra_data(
+    any(extra_data), name, destroy_when, force_unique );
+}
+
+
+template<class T1, class T2, class Policy>
+inline
+const T1& Teuchos::get_extra_data( const RCP<T2,Policy>& p,
+  const std::string& name )
+{
+  (void)sizeof(RCPPolicyAssertFeature<Policy::has_extra_data_support>);
+  p.assert_not_null();
+  return any_cast<T1>(
+    p.access_private_node().node_ptr()->extra_data().get_extra_data(
+      typeid(T1), name
+      )
+    );
+}
+
+
+template<class T1, class T2, class Policy>
+inline
+T1& Teuchos::get_nonconst_extra_data( RCP<T2,Policy>& p,
+  const std::string& name )
+{
+  (void)sizeof(RCPPolicyAssertFeature<Policy::has_extra_data_support>);
+  p.assert_not_null();
+  return any_cast<T1>(
+    p.access_private_node().node_ptr()->extra_data().get_extra_data(
+      typeid(T1), name
+      )
+    );
+}
+
+
+template<class T1, class T2, class Policy>
+inline
+Teuchos::Ptr<const T1>
+Teuchos::get_optional_extra_data( const RCP<T2,Policy>& p,
+  const std::string& name )
+{
+  (void)sizeof(RCPPolicyAssertFeature<Policy::has_extra_data_support>);
+  p.assert_not_null();
+  const any *extra_data =
+    p.access_private_node().node_ptr()->extra_data().get_optional_extra_data(
+      typeid(T1), name);
+  if (extra_data)
+    return Ptr<const T1>(&any_cast<T1>(*extra_data));
+  return null;
+}
+
+
+template<class Key, class T, class Policy>
+inline
+typename Teuchos::RCPPolicyEnableNonDefault<Policy,void>::type
+Teuchos::set_extra_data( const typename Key::value_type &extra_data,
+  const Ptr<RCP<T,Policy> > &p, EPrePostDestruction destroy_when )
+{
+  (void)sizeof(RCPPolicyAssertFeature<Policy::has_extra_data_support>);
+  p->assert_not_null();
+  p->access_private_node().node_ptr()->extra_data().template set_key_data<Key>(
+    extra_data, destroy_when);
+}
+
+
+template<class Key, class T, class Policy>
+inline
+const typename Key::value_type&
+Teuchos::get_extra_data( const RCP<T,Policy>& p )
+{
+  (void)sizeof(RCPPolicyAssertFeature<Policy::has_extra_data_support>);
+  p.assert_not_null();
+  return p.access_private_node().node_ptr()->extra_data().template get_key_data<Key>();
+}
+
+
+template<class Key, class T, class Policy>
+inline
+typename Key::value_type&
+Teuchos::get_nonconst_extra_data( RCP<T,Policy>& p )
+{
+  (void)sizeof(RCPPolicyAssertFeature<Policy::has_extra_data_support>);
+  p.assert_not_null();
+  return p.access_private_node().node_ptr()->extra_data().template get_key_data<Key>();
+}
+
+
+template<class Key, class T, class Policy>
+inline
+Teuchos::Ptr<const typename Key::value_type>
+Teuchos::get_optional_extra_data( const RCP<T,Policy>& p )
+{
+  (void)sizeof(RCPPolicyAssertFeature<Policy::has_extra_data_support>);
+  p.assert_not_null();
+  return Ptr<const typename Key::value_type>(
+    p.access_private_node().node_ptr()->extra_data().template get_optional_key_data<Key>());
+}
+
+
+template<class T, class Policy>
+std::ostream& Teuchos::operator<<( std::ostream& out, const RCP<T,Policy>& p )
+{
+  out
+    << typeName(p) << "{"
+    << "ptr="<<(const void*)(p.get()) // I can't find any alternative to this C cast :-(
+    <<",node="<<(const void*)(p.access_private_node().node_ptr())
+    <<",count="<<p.count()
+    <<"}";
+  return out;
+}
+
+
+#endif // TEUCHOS_RCP_POLICY_HPP
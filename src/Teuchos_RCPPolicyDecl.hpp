@@ -0,0 +1,763 @@
+// @HEADER
+// ***********************************************************************
+// 
+//                    Teuchos: Common Tools Package
+//                 Copyright (2004) Sandia Corporation
+// 
+// Under terms of Contract DE-AC04-94AL85000, there is a non-exclusive
+// license for use of this work by or on behalf of the U.S. Government.
+// 
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as
+// published by the Free Software Foundation; either version 2.1 of the
+// License, or (at your option) any later version.
+//  
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//  
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+// Questions? Contact Michael A. Heroux (maherou@sandia.gov) 
+// 
+// ***********************************************************************
+// @HEADER
+
+#ifndef TEUCHOS_RCP_POLICY_DECL_HPP
+#define TEUCHOS_RCP_POLICY_DECL_HPP
+
+
+/** \file Teuchos_RCPPolicyDecl.hpp
+ *
+ * \brief Reference-counted pointer class with compile-time selected features
+ * and its node classes.
+ */
+
+
+#include "Teuchos_RCPDecl.hpp"
+
+
+namespace Teuchos {
+
+
+/** \brief Reference counts of an <tt>RCPPolicyNode</tt> without weak support.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class Count_T, bool weakSupport>
+class RCPPolicyNodeCounts {
+public:
+  /** \brief . */
+  int strong_count() const { return strong_.get(); }
+  /** \brief . */
+  int weak_count() const { return 0; }
+  /** \brief . */
+  void incr_strong() { strong_.incr(); }
+  /** \brief Returns <tt>true</tt> if the object must be deleted. */
+  bool deincr_strong() { return strong_.deincr() == 0; }
+  /** \brief Called after the object is deleted and returns <tt>true</tt> if
+   * the node must be deleted. */
+  bool release_strong_ref_to_node() { return true; }
+private:
+  Count_T strong_;
+};
+
+
+/** \brief Reference counts of an <tt>RCPPolicyNode</tt> with weak support.
+ *
+ * The strong references together hold one weak reference to the node which
+ * is released by the one that deletes the object.  This way, the node is
+ * deleted by exactly one thread even when the last strong and the last weak
+ * references go away at the same time.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class Count_T>
+class RCPPolicyNodeCounts<Count_T, true> {
+public:
+  /** \brief . */
+  RCPPolicyNodeCounts() { weak_.incr(); }
+  /** \brief . */
+  int strong_count() const { return strong_.get(); }
+  /** \brief . */
+  int weak_count() const
+    {
+      const int strong_count = strong_.get();
+      return weak_.get() - (strong_count > 0 ? 1 : 0);
+    }
+  /** \brief . */
+  void incr_strong() { strong_.incr(); }
+  /** \brief Returns <tt>true</tt> if a strong reference was added (i.e. the
+   * object has not been deleted yet). */
+  bool incr_strong_if_valid() { return strong_.incr_if_nonzero(); }
+  /** \brief . */
+  void incr_weak() { weak_.incr(); }
+  /** \brief Returns <tt>true</tt> if the object must be deleted. */
+  bool deincr_strong() { return strong_.deincr() == 0; }
+  /** \brief Called after the object is deleted and returns <tt>true</tt> if
+   * the node must be deleted. */
+  bool release_strong_ref_to_node() { return weak_.deincr() == 0; }
+  /** \brief Returns <tt>true</tt> if the node must be deleted. */
+  bool deincr_weak() { return weak_.deincr() == 0; }
+private:
+  Count_T strong_;
+  Count_T weak_;
+};
+
+
+/** \brief Extra data storage of an <tt>RCPPolicyNode</tt> (none).
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<bool extraDataSupport>
+class RCPPolicyNodeExtraData {
+protected:
+  /** \brief . */
+  void pre_delete_extra_data() {}
+};
+
+
+/** \brief Extra data storage of an <tt>RCPPolicyNode</tt>.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<>
+class RCPPolicyNodeExtraData<true> {
+public:
+  /** \brief . */
+  RCPNodeExtraData& extra_data() { return extra_data_; }
+protected:
+  /** \brief . */
+  void pre_delete_extra_data() { extra_data_.pre_delete_extra_data(); }
+private:
+  RCPNodeExtraData extra_data_;
+};
+
+
+/** \brief Node class for <tt>RCP<T,Policy></tt> objects.
+ *
+ * Only the features selected by the template arguments take up storage.  In
+ * particular there is no ownership flag: a non-owning node just uses
+ * <tt>DeallocNull</tt>.  Policies that only differ in tracing support share
+ * the same node type.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class Count_T, bool weakSupport, bool extraDataSupport>
+class RCPPolicyNode
+  : public RCPPolicyNodeCounts<Count_T, weakSupport>,
+    public RCPPolicyNodeExtraData<extraDataSupport>
+{
+public:
+  /** \brief . */
+  RCPPolicyNode()
+#ifdef TEUCHOS_DEBUG
+    : traced_(false)
+#endif
+    {}
+  /** \brief . */
+  virtual ~RCPPolicyNode() {}
+  /** \brief . */
+  bool is_valid_ptr() const { return this->strong_count() > 0; }
+  /** \brief . */
+  virtual void delete_obj() = 0;
+#ifdef TEUCHOS_DEBUG
+  /** \brief . */
+  void set_traced(bool traced) { traced_ = traced; }
+  /** \brief . */
+  bool traced() const { return traced_; }
+private:
+  bool traced_;
+#endif
+private:
+  // Not defined and not to be called
+  RCPPolicyNode(const RCPPolicyNode&);
+  RCPPolicyNode& operator=(const RCPPolicyNode&);
+};
+
+
+/** \brief Gives the node type for a policy.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class Policy>
+struct RCPPolicyNodeType {
+  /** \brief . */
+  typedef RCPPolicyNode<typename Policy::count_t, Policy::has_weak_support,
+    Policy::has_extra_data_support> type;
+};
+
+
+/** \brief Templated implementation class of <tt>RCPPolicyNode</tt> that
+ * deletes the reference-counted object.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T, class Dealloc_T, class Node_T>
+class RCPPolicyNodeTmpl : public Node_T {
+public:
+  /** \brief . */
+  RCPPolicyNodeTmpl(T* p, Dealloc_T dealloc)
+    : ptr_(p), dealloc_(TEUCHOS_MOVE(dealloc))
+    {}
+  /** \brief . */
+  Dealloc_T& get_nonconst_dealloc()
+    { return dealloc_; }
+  /** \brief . */
+  const Dealloc_T& get_dealloc() const
+    { return dealloc_; }
+  /** \brief . */
+  virtual void delete_obj()
+    {
+      this->pre_delete_extra_data();
+      T* tmp_ptr = ptr_;
+      ptr_ = 0;
+      dealloc_.free(tmp_ptr);
+    }
+private:
+  T *ptr_;
+  Dealloc_T dealloc_;
+  // Not defined and not to be called
+  RCPPolicyNodeTmpl();
+  RCPPolicyNodeTmpl(const RCPPolicyNodeTmpl&);
+  RCPPolicyNodeTmpl& operator=(const RCPPolicyNodeTmpl&);
+};
+
+
+/** \brief Delete the object of a node whose last strong reference has just
+ * been released and then the node itself if no weak references remain.
+ *
+ * If the deallocator throws, the exception propagates and the node is not
+ * deleted.
+ *
+ * This is not a general user-level function.
+ */
+template<class Node_T>
+void RCPPolicyNodeHandle_deleteObjAndNode(Node_T* node)
+{
+  if (isRCPFastExitInProgress())
+    return; // Leave the object and node for the OS to clean up
+#ifdef TEUCHOS_DEBUG
+  if (node->traced()) {
+    node->set_traced(false);
+    RCPNodeTracer::removePolicyRCPNode(node);
+  }
+#endif
+  node->delete_obj();
+  if (node->release_strong_ref_to_node())
+    delete node;
+}
+
+
+/** \brief Handle class that manages the reference counts of an
+ * <tt>RCPPolicyNode</tt> that has no weak support.
+ *
+ * Such a handle is always strong and is just one pointer.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class Node_T, bool weakSupport>
+class RCPPolicyNodeHandle {
+public:
+  /** \brief . */
+  RCPPolicyNodeHandle(ENull null_arg = null)
+    : node_(0)
+    {(void)null_arg;}
+  /** \brief . */
+  explicit RCPPolicyNodeHandle(Node_T* node)
+    : node_(node)
+    {
+      bind();
+    }
+  /** \brief . */
+  RCPPolicyNodeHandle(const RCPPolicyNodeHandle& node_ref)
+    : node_(node_ref.node_)
+    {
+      bind();
+    }
+  /** \brief . */
+  ~RCPPolicyNodeHandle()
+    {
+      unbind();
+    }
+  /** \brief . */
+  RCPPolicyNodeHandle& operator=(const RCPPolicyNodeHandle& node_ref)
+    {
+      RCPPolicyNodeHandle(node_ref).swap(*this);
+      return *this;
+    }
+  /** \brief . */
+  void swap(RCPPolicyNodeHandle& node_ref)
+    {
+      std::swap(node_ref.node_, node_);
+    }
+  /** \brief . */
+  Node_T* node_ptr() const { return node_; }
+  /** \brief . */
+  bool same_node(const RCPPolicyNodeHandle &node2) const
+    { return node_ == node2.node_; }
+  /** \brief . */
+  ERCPStrength strength() const
+    { return node_ ? RCP_STRONG : RCP_STRENGTH_INVALID; }
+  /** \brief . */
+  bool is_valid_ptr() const { return true; }
+  /** \brief . */
+  int strong_count() const { return node_ ? node_->strong_count() : 0; }
+  /** \brief . */
+  int weak_count() const { return 0; }
+private:
+  Node_T *node_;
+  void bind()
+    {
+      if (node_)
+        node_->incr_strong();
+    }
+  void unbind()
+    {
+      if (node_ && node_->deincr_strong())
+        RCPPolicyNodeHandle_deleteObjAndNode(node_);
+    }
+};
+
+
+/** \brief Handle class that manages the reference counts of an
+ * <tt>RCPPolicyNode</tt> with weak support.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class Node_T>
+class RCPPolicyNodeHandle<Node_T, true> {
+public:
+  /** \brief . */
+  RCPPolicyNodeHandle(ENull null_arg = null)
+    : node_(0), strength_(RCP_STRENGTH_INVALID)
+    {(void)null_arg;}
+  /** \brief . */
+  explicit RCPPolicyNodeHandle(Node_T* node,
+    ERCPStrength strength_in = RCP_STRONG)
+    : node_(node), strength_(node ? strength_in : RCP_STRENGTH_INVALID)
+    {
+      bind();
+    }
+  /** \brief . */
+  RCPPolicyNodeHandle(const RCPPolicyNodeHandle& node_ref)
+    : node_(node_ref.node_), strength_(node_ref.strength_)
+    {
+      bind();
+    }
+  /** \brief . */
+  ~RCPPolicyNodeHandle()
+    {
+      unbind();
+    }
+  /** \brief . */
+  RCPPolicyNodeHandle& operator=(const RCPPolicyNodeHandle& node_ref)
+    {
+      RCPPolicyNodeHandle(node_ref).swap(*this);
+      return *this;
+    }
+  /** \brief . */
+  void swap(RCPPolicyNodeHandle& node_ref)
+    {
+      std::swap(node_ref.node_, node_);
+      std::swap(node_ref.strength_, strength_);
+    }
+  /** \brief . */
+  RCPPolicyNodeHandle create_weak() const
+    { return RCPPolicyNodeHandle(node_, RCP_WEAK); }
+  /** \brief Returns a null handle if the object has already been deleted. */
+  RCPPolicyNodeHandle create_strong() const
+    {
+      RCPPolicyNodeHandle strongHandle;
+      if (node_ && node_->incr_strong_if_valid()) {
+        strongHandle.node_ = node_;
+        strongHandle.strength_ = RCP_STRONG;
+      }
+      return strongHandle;
+    }
+  /** \brief . */
+  Node_T* node_ptr() const { return node_; }
+  /** \brief . */
+  bool same_node(const RCPPolicyNodeHandle &node2) const
+    { return node_ == node2.node_; }
+  /** \brief . */
+  ERCPStrength strength() const { return strength_; }
+  /** \brief . */
+  bool is_valid_ptr() const
+    { return node_ ? node_->is_valid_ptr() : true; }
+  /** \brief . */
+  int strong_count() const { return node_ ? node_->strong_count() : 0; }
+  /** \brief . */
+  int weak_count() const { return node_ ? node_->weak_count() : 0; }
+private:
+  Node_T *node_;
+  ERCPStrength strength_;
+  void bind()
+    {
+      if (node_) {
+        if (strength_ == RCP_STRONG)
+          node_->incr_strong();
+        else
+          node_->incr_weak();
+      }
+    }
+  void unbind()
+    {
+      if (!node_)
+        return;
+      if (strength_ == RCP_STRONG) {
+        if (node_->deincr_strong())
+          RCPPolicyNodeHandle_deleteObjAndNode(node_);
+      }
+      else if (node_->deincr_weak()) {
+        delete node_;
+      }
+    }
+};
+
+
+/** \brief Smart reference counting pointer class with the features selected
+ * by <tt>Policy</tt> at compile time.
+ *
+ * This is the same interface as the fully featured <tt>RCP<T></tt> (see
+ * <tt>Teuchos_RCPDecl.hpp</tt>) except for what <tt>Policy</tt> turns off:
+
+ <ul>
+
+ <li> Without weak support, <tt>create_weak()</tt> and
+ <tt>create_strong()</tt> will not compile and the object is one pointer
+ plus one pointer to a node holding a single count.
+
+ <li> Without extra data support, <tt>set_extra_data()</tt> and friends will
+ not compile.
+
+ <li> Without tracing support, no debug-mode checking is performed at all,
+ not even for dereferencing a null pointer.
+
+ </ul>
+
+ * There is no ownership flag; pass <tt>has_ownership=false</tt> (or a
+ * <tt>DeallocNull</tt> deallocator) to create a non-owning object.
+ *
+ * An <tt>RCP<T2,Policy2></tt> object converts implicitly to an
+ * <tt>RCP<T,Policy></tt> object if <tt>T2*</tt> converts to <tt>T*</tt> and
+ * <tt>RCPPolicyCompatible<Policy2,Policy>::value</tt> is <tt>true</tt>.  To
+ * convert to or from the fully featured <tt>RCP<T></tt> use
+ * <tt>rcpWithPolicy()</tt> and <tt>rcpWithDefaultPolicy()</tt> which embed
+ * the source object in a new node.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T, class Policy>
+class RCP {
+public:
+
+  /** \brief . */
+  typedef T element_type;
+  /** \brief . */
+  typedef Policy policy_t;
+  /** \brief . */
+  typedef typename RCPPolicyNodeType<Policy>::type node_t;
+  /** \brief . */
+  typedef RCPPolicyNodeHandle<node_t, Policy::has_weak_support> node_handle_t;
+
+  /** \name Constructors/destructors/initializers. */
+  //@{
+
+  /** \brief . */
+  inline RCP(ENull null_arg = null);
+  /** \brief Construct from a raw pointer that is deleted with
+   * <tt>delete</tt> if <tt>has_ownership==true</tt>. */
+  inline explicit RCP(T* p, bool has_ownership = true);
+  /** \brief Construct from a raw pointer and a custom deallocator. */
+  template<class Dealloc_T>
+  inline RCP(T* p, Dealloc_T dealloc);
+  /** \brief . */
+  inline RCP(const RCP<T,Policy>& r_ptr);
+  /** \brief Implicit conversion from a compatible policy and/or a derived
+   * type. */
+  template<class T2, class Policy2>
+  inline RCP(const RCP<T2,Policy2>& r_ptr);
+  /** \brief . */
+  inline ~RCP();
+  /** \brief . */
+  inline RCP<T,Policy>& operator=(const RCP<T,Policy>& r_ptr);
+  /** \brief . */
+  inline RCP<T,Policy>& operator=(ENull);
+  /** \brief . */
+  inline void swap(RCP<T,Policy> &r_ptr);
+
+  //@}
+
+  /** \name Object query and access functions. */
+  //@{
+
+  /** \brief . */
+  inline bool is_null() const;
+  /** \brief . */
+  inline T* operator->() const;
+  /** \brief . */
+  inline T& operator*() const;
+  /** \brief . */
+  inline T* get() const;
+  /** \brief . */
+  inline T* getRawPtr() const;
+
+  //@}
+
+  /** \name Reference counting. */
+  //@{
+
+  /** \brief . */
+  inline ERCPStrength strength() const;
+  /** \brief . */
+  inline bool is_valid_ptr() const;
+  /** \brief . */
+  inline int strong_count() const;
+  /** \brief . */
+  inline int weak_count() const;
+  /** \brief . */
+  inline int total_count() const;
+  /** \brief Create a new weak RCP object (requires weak support). */
+  inline RCP<T,Policy> create_weak() const;
+  /** \brief Create a new strong RCP object (requires weak support).
+   *
+   * Returns null if the object has already been deleted.  This is safe to
+   * call concurrently with the release of the last strong reference if
+   * counting is thread-safe.
+   */
+  inline RCP<T,Policy> create_strong() const;
+  /** \brief . */
+  template<class T2, class Policy2>
+  inline bool shares_resource(const RCP<T2,Policy2>& r_ptr) const;
+
+  //@}
+
+  /** \name Assertions. */
+  //@{
+
+  /** \brief . */
+  inline const RCP<T,Policy>& assert_not_null() const;
+  /** \brief . */
+  inline const RCP<T,Policy>& assert_valid_ptr() const;
+  /** \brief Calls <tt>assert_not_null()</tt> in a debug build if
+   * <tt>Policy</tt> supports tracing. */
+  inline const RCP<T,Policy>& debug_assert_not_null() const
+    {
+#ifdef TEUCHOS_DEBUG
+      if (Policy::has_tracing_support)
+        assert_not_null();
+#endif
+      return *this;
+    }
+  /** \brief Calls <tt>assert_valid_ptr()</tt> in a debug build if
+   * <tt>Policy</tt> supports tracing. */
+  inline const RCP<T,Policy>& debug_assert_valid_ptr() const
+    {
+#ifdef TEUCHOS_DEBUG
+      if (Policy::has_tracing_support)
+        assert_valid_ptr();
+#endif
+      return *this;
+    }
+
+  //@}
+
+  /** \name boost::shared_ptr compatiblity funtions. */
+  //@{
+
+  /** \brief . */
+  inline void reset();
+  /** \brief . */
+  inline int count() const;
+
+  //@}
+
+private:
+
+  T *ptr_; // NULL if this pointer is null
+  node_handle_t node_; // NULL if this pointer is null
+
+public: // Bad bad bad
+
+#ifndef DOXYGEN_COMPILE
+
+  // WARNING: A general user should *never* call these functions!
+  inline RCP(T* p, const node_handle_t &node);
+  inline T* access_private_ptr() const; // Does not throw
+  inline node_handle_t& nonconst_access_private_node(); // Does not thorw
+  inline const node_handle_t& access_private_node() const; // Does not thorw
+
+#endif
+
+};
+
+
+/** \brief Create an <tt>RCP<T,Policy></tt> object properly typed.
+ *
+ * \relates RCP
+ */
+template<class Policy, class T> inline
+RCP<T,Policy> rcpWithPolicy(T* p, bool owns_mem = true);
+
+
+/** \brief Create an <tt>RCP<T,Policy></tt> object with a deallocation
+ * policy.
+ *
+ * \relates RCP
+ */
+template<class Policy, class T, class Dealloc_T> inline
+RCP<T,Policy> rcpWithPolicyAndDealloc(T* p, Dealloc_T dealloc);
+
+
+/** \brief Create an <tt>RCP<T,Policy></tt> object that keeps a fully
+ * featured <tt>RCP<T></tt> object alive.
+ *
+ * The new object has its own node that embeds a copy of <tt>p</tt>.
+ *
+ * \relates RCP
+ */
+template<class Policy, class T>
+RCP<T,Policy> rcpWithPolicy(const RCP<T> &p);
+
+
+/** \brief Create a fully featured <tt>RCP<T></tt> object that keeps an
+ * <tt>RCP<T,Policy></tt> object alive.
+ *
+ * The new object has its own node that embeds a copy of <tt>p</tt>.
+ *
+ * \relates RCP
+ */
+template<class T, class Policy>
+RCP<T> rcpWithDefaultPolicy(const RCP<T,Policy> &p);
+
+
+/** \brief . */
+template<class T, class Policy> inline
+bool is_null( const RCP<T,Policy> &p );
+
+
+/** \brief . */
+template<class T, class Policy> inline
+bool nonnull( const RCP<T,Policy> &p );
+
+
+/** \brief . */
+template<class T, class Policy> inline
+bool operator==( const RCP<T,Policy> &p, ENull );
+
+
+/** \brief . */
+template<class T, class Policy> inline
+bool operator!=( const RCP<T,Policy> &p, ENull );
+
+
+/** \brief Return true if <tt>p1</tt> and <tt>p2</tt> share the same node. */
+template<class T1, class T2, class Policy> inline
+bool operator==( const RCP<T1,Policy> &p1, const RCP<T2,Policy> &p2 );
+
+
+/** \brief . */
+template<class T1, class T2, class Policy> inline
+bool operator!=( const RCP<T1,Policy> &p1, const RCP<T2,Policy> &p2 );
+
+
+/** \brief . */
+template<class T2, class T1, class Policy> inline
+RCP<T2,Policy> rcp_implicit_cast(const RCP<T1,Policy>& p1);
+
+
+/** \brief . */
+template<class T2, class T1, class Policy> inline
+RCP<T2,Policy> rcp_static_cast(const RCP<T1,Policy>& p1);
+
+
+/** \brief . */
+template<class T2, class T1, class Policy> inline
+RCP<T2,Policy> rcp_const_cast(const RCP<T1,Policy>& p1);
+
+
+/** \brief . */
+template<class T2, class T1, class Policy> inline
+RCP<T2,Policy> rcp_dynamic_cast(
+  const RCP<T1,Policy>& p1, bool throw_on_fail = false );
+
+
+/** \brief Set extra data (requires extra data support).
+ *
+ * See the <tt>RCP<T></tt> version for details.
+ *
+ * \relates RCP
+ */
+template<class T1, class T2, class Policy>
+void set_extra_data( const T1 &extra_data, const std::string& name,
+  const Ptr<RCP<T2,Policy> > &p, EPrePostDestruction destroy_when = POST_DESTROY,
+  bool force_unique = true);
+
+
+/** \brief . */
+template<class T1, class T2, class Policy>
+const T1& get_extra_data( const RCP<T2,Policy>& p, const std::string& name );
+
+
+/** \brief . */
+template<class T1, class T2, class Policy>
+T1& get_nonconst_extra_data( RCP<T2,Policy>& p, const std::string& name );
+
+
+/** \brief . */
+template<class T1, class T2, class Policy>
+Ptr<const T1> get_optional_extra_data( const RCP<T2,Policy>& p,
+  const std::string& name );
+
+
+/** \brief Set statically typed extra data (requires extra data support).
+ *
+ * See the <tt>RCP<T></tt> version for details.
+ *
+ * \relates RCP
+ */
+template<class Key, class T, class Policy>
+typename RCPPolicyEnableNonDefault<Policy,void>::type
+set_extra_data( const typename Key::value_type &extra_data,
+  const Ptr<RCP<T,Policy> > &p, EPrePostDestruction destroy_when = POST_DESTROY );
+
+
+/** \brief . */
+template<class Key, class T, class Policy>
+const typename Key::value_type& get_extra_data( const RCP<T,Policy>& p );
+
+
+/** \brief . */
+template<class Key, class T, class Policy>
+typename Key::value_type& get_nonconst_extra_data( RCP<T,Policy>& p );
+
+
+/** \brief . */
+template<class Key, class T, class Policy>
+Ptr<const typename Key::value_type>
+get_optional_extra_data( const RCP<T,Policy>& p );
+
+
+/** \brief . */
+template<class T, class Policy>
+std::ostream& operator<<( std::ostream& out, const RCP<T,Policy>& p );
+
+
+} // namespace Teuchos
+
+
+#endif // TEUCHOS_RCP_POLICY_DECL_HPP
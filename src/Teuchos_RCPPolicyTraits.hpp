@@ -0,0 +1,257 @@
+// @HEADER
+// ***********************************************************************
+// 
+//                    Teuchos: Common Tools Package
+//                 Copyright (2004) Sandia Corporation
+// 
+// Under terms of Contract DE-AC04-94AL85000, there is a non-exclusive
+// license for use of this work by or on behalf of the U.S. Government.
+// 
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as
+// published by the Free Software Foundation; either version 2.1 of the
+// License, or (at your option) any later version.
+//  
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//  
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+// Questions? Contact Michael A. Heroux (maherou@sandia.gov) 
+// 
+// ***********************************************************************
+// @HEADER
+
+#ifndef TEUCHOS_RCP_POLICY_TRAITS_HPP
+#define TEUCHOS_RCP_POLICY_TRAITS_HPP
+
+
+/** \file Teuchos_RCPPolicyTraits.hpp
+ *
+ * \brief Compile-time policies that select the features of an
+ * <tt>RCP<T,Policy></tt> object.
+ */
+
+
+#include "Teuchos_ConfigDefs.hpp"
+
+#ifdef HAVE_TEUCHOS_CXX11
+#  include <atomic>
+#endif
+
+
+namespace Teuchos {
+
+
+/** \brief Non-thread-safe reference count used by <tt>RCPPolicy</tt>.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+class RCPCountSingleThreaded {
+public:
+  /** \brief . */
+  RCPCountSingleThreaded() : count_(0) {}
+  /** \brief . */
+  int get() const { return count_; }
+  /** \brief Increment and return the new count. */
+  int incr() { return ++count_; }
+  /** \brief Deincrement and return the new count. */
+  int deincr() { return --count_; }
+  /** \brief Increment only if the count is not zero and return if it was. */
+  bool incr_if_nonzero()
+    {
+      if (count_ == 0)
+        return false;
+      ++count_;
+      return true;
+    }
+private:
+  int count_;
+  // Not defined and not to be called
+  RCPCountSingleThreaded(const RCPCountSingleThreaded&);
+  RCPCountSingleThreaded& operator=(const RCPCountSingleThreaded&);
+};
+
+
+#ifdef HAVE_TEUCHOS_CXX11
+
+
+/** \brief Thread-safe reference count used by <tt>RCPPolicy</tt>.
+ *
+ * Increments are relaxed since a new reference can only be created from an
+ * existing one.  Deincrements are acquire/release so that all of the writes
+ * to the object happen before it is deleted by the thread that took the
+ * count to zero.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+class RCPCountAtomic {
+public:
+  /** \brief . */
+  RCPCountAtomic() : count_(0) {}
+  /** \brief . */
+  int get() const { return count_.load(std::memory_order_acquire); }
+  /** \brief Increment and return the new count. */
+  int incr() { return count_.fetch_add(1, std::memory_order_relaxed) + 1; }
+  /** \brief Deincrement and return the new count. */
+  int deincr() { return count_.fetch_sub(1, std::memory_order_acq_rel) - 1; }
+  /** \brief Increment only if the count is not zero and return if it was. */
+  bool incr_if_nonzero()
+    {
+      int count = count_.load(std::memory_order_relaxed);
+      while (count != 0) {
+        if (count_.compare_exchange_weak(count, count + 1,
+            std::memory_order_acq_rel, std::memory_order_relaxed))
+          return true;
+      }
+      return false;
+    }
+private:
+  std::atomic<int> count_;
+  // Not defined and not to be called
+  RCPCountAtomic(const RCPCountAtomic&);
+  RCPCountAtomic& operator=(const RCPCountAtomic&);
+};
+
+
+#endif // HAVE_TEUCHOS_CXX11
+
+
+/** \brief Policy class that selects the features of an
+ * <tt>RCP<T,Policy></tt> object at compile time.
+ *
+ * \param Count_T [in] The reference count type.  This is either
+ * <tt>RCPCountSingleThreaded</tt> or <tt>RCPCountAtomic</tt>.
+ *
+ * \param weakSupport [in] If <tt>true</tt>, then the node stores a weak count
+ * and the functions <tt>create_weak()</tt>, <tt>create_strong()</tt> and
+ * <tt>weak_count()</tt> can be called.
+ *
+ * \param extraDataSupport [in] If <tt>true</tt>, then the node can store
+ * extra data (see <tt>set_extra_data()</tt>).
+ *
+ * \param tracingSupport [in] If <tt>true</tt>, then in a debug build
+ * (i.e. <tt>TEUCHOS_DEBUG</tt> defined) the node is added to the list of
+ * active nodes in <tt>RCPNodeTracer</tt> and dereferencing a null or
+ * dangling <tt>RCP</tt> is checked.  This has no effect in a release build.
+ *
+ * Each feature that is turned off removes the storage and the runtime
+ * overhead for it.  The fully featured <tt>RCP<T></tt> is selected with
+ * <tt>RCPDefaultPolicy</tt> instead.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class Count_T, bool weakSupport, bool extraDataSupport,
+  bool tracingSupport>
+struct RCPPolicy {
+  /** \brief . */
+  typedef Count_T count_t;
+  /** \brief . */
+  static const bool has_weak_support = weakSupport;
+  /** \brief . */
+  static const bool has_extra_data_support = extraDataSupport;
+  /** \brief . */
+  static const bool has_tracing_support = tracingSupport;
+};
+
+
+/** \brief The policy for the fully featured <tt>RCP<T></tt> that uses
+ * <tt>RCPNode</tt>.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+struct RCPDefaultPolicy {};
+
+
+/** \brief Strong count only, no extra data and no tracing.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+typedef RCPPolicy<RCPCountSingleThreaded,false,false,false> RCPLeanPolicy;
+
+
+#ifdef HAVE_TEUCHOS_CXX11
+/** \brief Same as <tt>RCPLeanPolicy</tt> but with thread-safe counting.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+typedef RCPPolicy<RCPCountAtomic,false,false,false> RCPLeanAtomicPolicy;
+#endif
+
+
+/** \brief Traits class that determines if an <tt>RCP<T,FromPolicy></tt>
+ * object can share its node with an <tt>RCP<T,ToPolicy></tt> object.
+ *
+ * Two policies are compatible if their nodes have the same layout, that is
+ * they only differ in <tt>tracingSupport</tt>.  Whether a node is traced is
+ * decided when it is created.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class FromPolicy, class ToPolicy>
+struct RCPPolicyCompatible {
+  /** \brief . */
+  static const bool value = false;
+};
+
+
+/** \brief . */
+template<>
+struct RCPPolicyCompatible<RCPDefaultPolicy, RCPDefaultPolicy> {
+  /** \brief . */
+  static const bool value = true;
+};
+
+
+/** \brief . */
+template<class Count_T, bool weakSupport, bool extraDataSupport,
+  bool fromTracingSupport, bool toTracingSupport>
+struct RCPPolicyCompatible<
+  RCPPolicy<Count_T,weakSupport,extraDataSupport,fromTracingSupport>,
+  RCPPolicy<Count_T,weakSupport,extraDataSupport,toTracingSupport> >
+{
+  /** \brief . */
+  static const bool value = true;
+};
+
+
+/** \brief Defines <tt>type</tt> as <tt>T</tt> for every policy except
+ * <tt>RCPDefaultPolicy</tt>.
+ *
+ * Used in the return type of <tt>RCP<T,Policy></tt> overloads that partial
+ * ordering can not tell apart from the <tt>RCP<T></tt> overloads (e.g. when
+ * the first argument is a non-deduced context).
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class Policy, class T>
+struct RCPPolicyEnableNonDefault {
+  /** \brief . */
+  typedef T type;
+};
+
+
+/** \brief . */
+template<class T>
+struct RCPPolicyEnableNonDefault<RCPDefaultPolicy, T> {};
+
+
+/** \brief Only defined for <tt>true</tt> to give a compile-time error when
+ * an <tt>RCP<T,Policy></tt> feature is used that the policy turned off.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<bool policySupportsFeature> struct RCPPolicyAssertFeature;
+
+/** \brief . */
+template<> struct RCPPolicyAssertFeature<true> { enum { value = 1 }; };
+
+
+} // namespace Teuchos
+
+
+#endif // TEUCHOS_RCP_POLICY_TRAITS_HPP
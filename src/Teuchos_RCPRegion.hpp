@@ -0,0 +1,345 @@
+// @HEADER
+// ***********************************************************************
+// 
+//                    Teuchos: Common Tools Package
+//                 Copyright (2004) Sandia Corporation
+// 
+// Under terms of Contract DE-AC04-94AL85000, there is a non-exclusive
+// license for use of this work by or on behalf of the U.S. Government.
+// 
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as
+// published by the Free Software Foundation; either version 2.1 of the
+// License, or (at your option) any later version.
+//  
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//  
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+// Questions? Contact Michael A. Heroux (maherou@sandia.gov) 
+// 
+// ***********************************************************************
+// @HEADER
+
+#ifndef TEUCHOS_RCP_REGION_HPP
+#define TEUCHOS_RCP_REGION_HPP
+
+
+/** \file Teuchos_RCPRegion.hpp
+ *
+ * \brief Region of memory that <tt>RCP</tt> objects and their nodes are
+ * created in and that is released all at once.
+ */
+
+
+#include "Teuchos_RCP.hpp"
+
+#ifndef HAVE_TEUCHOS_CXX11
+#  error "Teuchos_RCPRegion.hpp requires a C++11 compiler"
+#endif
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#ifdef TEUCHOS_DEBUG
+#  include <atomic>
+#endif
+
+
+namespace Teuchos {
+
+
+class RCPRegion;
+
+
+/** \brief Deallocator policy class for objects in an <tt>RCPRegion</tt>
+ * that only calls the destructor (the memory belongs to the region).
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T>
+class RCPRegionDealloc
+{
+public:
+  /** \brief . */
+  typedef T ptr_t;
+  /** \brief . */
+  void free( T* ptr ) { if (ptr) ptr->~T(); }
+};
+
+
+/** \brief Node class for objects created in an <tt>RCPRegion</tt>.
+ *
+ * The node lives in the region and is never freed on its own.  The object is
+ * destroyed as usual when its last strong reference goes away but the region
+ * holds one of those until it is released.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T>
+class RCPRegionNodeTmpl : public RCPNodeTmpl<T, RCPRegionDealloc<T> > {
+public:
+  /** \brief . */
+  inline RCPRegionNodeTmpl(T* p, RCPRegion &region);
+#ifdef TEUCHOS_DEBUG
+  /** \brief . */
+  inline ~RCPRegionNodeTmpl();
+  /** \brief . */
+  std::size_t get_node_size() const
+    {
+      return sizeof(*this);
+    }
+#endif
+  /** \brief Only used by <tt>RCPRegion</tt>. */
+  static void* operator new(std::size_t, void* p)
+    {
+      return p;
+    }
+  /** \brief The memory belongs to the region. */
+  static void operator delete(void*)
+    {}
+  /** \brief . */
+  static void operator delete(void*, void*)
+    {}
+private:
+#ifdef TEUCHOS_DEBUG
+  RCPRegion &region_;
+#endif
+  // Not defined and not to be called
+  RCPRegionNodeTmpl();
+  RCPRegionNodeTmpl(const RCPRegionNodeTmpl&);
+  RCPRegionNodeTmpl& operator=(const RCPRegionNodeTmpl&);
+};
+
+
+/** \brief Region that <tt>RCP</tt>-managed objects are created in and that
+ * is released in one step.
+ *
+ * This is for graphs of objects that are linked with <tt>RCP</tt>s and
+ * that all go away together, such as the objects for one request:
+
+ \code
+  RCPRegion region;
+  RCP<Request> req = region.create<Request>(...);
+  req->setHandler(region.create<Handler>(...));
+  ...
+  req = null;
+  region.release(); // or just let region go out of scope
+ \endcode
+
+ * Both the objects and their <tt>RCPNode</tt>s are bump-allocated from
+ * chunks owned by the region.  The region holds a strong reference to each
+ * object (except for trivially destructible types) so dropping the last
+ * client reference does not destroy it or free any memory.  Instead,
+ * <tt>release()</tt> drops the region's references in the reverse order of
+ * creation and then frees all of the chunks at once.  An object is destroyed
+ * when its last strong reference goes away as usual, so an object that is
+ * still referenced by another object in the region (like the handler above)
+ * is destroyed after the object referencing it no matter which was created
+ * first.  Cycles of strong references must be broken as for any other RCPs
+ * (e.g. with weak back references) or their objects are never destroyed.
+ *
+ * No <tt>RCP</tt> (strong or weak) to an object in the region may be left
+ * when the region is released, other than those held by objects in the
+ * region itself.  In a debug build, <tt>release()</tt> reports an error and
+ * aborts the program if any are left (their memory is about to be freed).
+ * In a release build this is not checked.
+ *
+ * Creating objects is not thread safe but the <tt>RCP</tt>s can be shared
+ * between threads as usual.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+class RCPRegion {
+public:
+
+  /** \brief Construct an empty region that allocates chunks of (at least)
+   * <tt>chunkSize</tt> bytes. */
+  explicit RCPRegion( std::size_t chunkSize = 65536 )
+    : chunkSize_(chunkSize), chunks_(0), cur_(0), end_(0), refs_(0),
+      numObjects_(0), numBytesAllocated_(0)
+#ifdef TEUCHOS_DEBUG
+    , numLiveNodes_(0)
+#endif
+    {}
+
+  /** \brief Calls <tt>release()</tt>. */
+  ~RCPRegion()
+    {
+      release();
+      if (chunks_)
+        freeChunk(chunks_);
+    }
+
+  /** \brief Create a new object of type <tt>T</tt> in the region. */
+  template<class T, class... Args>
+  RCP<T> create( Args&&... args )
+    {
+      typedef RCPRegionNodeTmpl<T> node_t;
+      void *rec = 0;
+      if (!std::is_trivially_destructible<T>::value)
+        rec = allocate(sizeof(RefRecord), alignof(RefRecord));
+      T *p = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+      ++numObjects_;
+      RCPNode *node = new (allocate(sizeof(node_t), alignof(node_t))) node_t(p, *this);
+#ifdef TEUCHOS_DEBUG
+      RCPNodeThrowDeleter nodeDeleter(node);
+      RCPNodeHandle nodeHandle(node, p, typeName(*p), concreteTypeName(*p), true);
+      nodeDeleter.release();
+#else
+      RCPNodeHandle nodeHandle(node);
+#endif
+      if (rec)
+        refs_ = new (rec) RefRecord(refs_, nodeHandle);
+      return RCP<T>(p, TEUCHOS_MOVE(nodeHandle));
+    }
+
+  /** \brief Destroy all of the objects and free the memory.
+   *
+   * The region is empty afterwards and can be used again.  One chunk is
+   * kept for that.
+   */
+  void release()
+    {
+      while (refs_) {
+        RefRecord *rec = refs_;
+        refs_ = rec->prev;
+        rec->~RefRecord(); // May destroy the object and others it references
+      }
+#ifdef TEUCHOS_DEBUG
+      const long int numLiveNodes = numLiveNodes_.load();
+      TEST_FOR_TERMINATION( numLiveNodes != 0,
+        "Error, RCPRegion::release(): " << numLiveNodes << " RCPNode object(s)"
+        " for objects in this region are still referenced by RCP objects"
+        " outside of the region (or by a cycle of strong RCPs)!" );
+#endif
+      if (chunks_) {
+        while (chunks_->prev) {
+          Chunk *prev = chunks_->prev;
+          chunks_->prev = prev->prev;
+          freeChunk(prev);
+        }
+        cur_ = chunks_->data();
+        end_ = cur_ + chunks_->size;
+        numBytesAllocated_ = chunks_->size;
+      }
+      numObjects_ = 0;
+    }
+
+  /** \brief Number of objects created since the last <tt>release()</tt>. */
+  std::size_t numObjects() const
+    {
+      return numObjects_;
+    }
+
+  /** \brief Number of bytes in the chunks held by the region. */
+  std::size_t numBytesAllocated() const
+    {
+      return numBytesAllocated_;
+    }
+
+private:
+
+  template<class T> friend class RCPRegionNodeTmpl;
+
+  struct Chunk {
+    Chunk *prev;
+    std::size_t size;
+    char* data() { return reinterpret_cast<char*>(this + 1); }
+  };
+
+  // The region's own strong reference to an object
+  struct RefRecord {
+    RefRecord(RefRecord *prev_in, const RCPNodeHandle &node_in)
+      : prev(prev_in), node(node_in)
+      {}
+    RefRecord *prev;
+    RCPNodeHandle node;
+  };
+
+  std::size_t chunkSize_;
+  Chunk *chunks_;
+  char *cur_;
+  char *end_;
+  RefRecord *refs_;
+  std::size_t numObjects_;
+  std::size_t numBytesAllocated_;
+#ifdef TEUCHOS_DEBUG
+  std::atomic<long int> numLiveNodes_;
+#endif
+
+  static char* alignUp(char* p, std::size_t align)
+    {
+      const std::size_t addr = reinterpret_cast<std::size_t>(p);
+      return p + ((align - addr % align) % align);
+    }
+
+  void* allocate(std::size_t size, std::size_t align)
+    {
+      char *p = alignUp(cur_, align);
+      if (!cur_ || p + size > end_) {
+        const std::size_t minSize = size + align;
+        const std::size_t newSize = minSize > chunkSize_ ? minSize : chunkSize_;
+        Chunk *chunk = static_cast<Chunk*>(::operator new(sizeof(Chunk) + newSize));
+        chunk->prev = chunks_;
+        chunk->size = newSize;
+        chunks_ = chunk;
+        cur_ = chunk->data();
+        end_ = cur_ + newSize;
+        numBytesAllocated_ += newSize;
+        p = alignUp(cur_, align);
+      }
+      cur_ = p + size;
+      return p;
+    }
+
+  static void freeChunk(Chunk* chunk)
+    {
+      ::operator delete(chunk);
+    }
+
+  // Not defined and not to be called
+  RCPRegion(const RCPRegion&);
+  RCPRegion& operator=(const RCPRegion&);
+
+};
+
+
+template<class T>
+inline
+RCPRegionNodeTmpl<T>::RCPRegionNodeTmpl(T* p, RCPRegion &region)
+  : RCPNodeTmpl<T, RCPRegionDealloc<T> >(p, RCPRegionDealloc<T>(), true)
+#ifdef TEUCHOS_DEBUG
+  , region_(region)
+#endif
+{
+#ifdef TEUCHOS_DEBUG
+  ++region_.numLiveNodes_;
+#else
+  (void)region;
+#endif
+}
+
+
+#ifdef TEUCHOS_DEBUG
+template<class T>
+inline
+RCPRegionNodeTmpl<T>::~RCPRegionNodeTmpl()
+{
+  --region_.numLiveNodes_;
+}
+#endif
+
+
+} // namespace Teuchos
+
+
+#endif // TEUCHOS_RCP_REGION_HPP
@@ -0,0 +1,450 @@
+// @HEADER
+// ***********************************************************************
+// 
+//                    Teuchos: Common Tools Package
+//                 Copyright (2004) Sandia Corporation
+// 
+// Under terms of Contract DE-AC04-94AL85000, there is a non-exclusive
+// license for use of this work by or on behalf of the U.S. Government.
+// 
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as
+// published by the Free Software Foundation; either version 2.1 of the
+// License, or (at your option) any later version.
+//  
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//  
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+// Questions? Contact Michael A. Heroux (maherou@sandia.gov) 
+// 
+// ***********************************************************************
+// @HEADER
+
+#ifndef TEUCHOS_SLOT_MAP_HPP
+#define TEUCHOS_SLOT_MAP_HPP
+
+
+/** \file Teuchos_SlotMap.hpp
+ *
+ * \brief Container of objects addressed through generational handles that
+ * can be promoted to <tt>RCP</tt> objects.
+ */
+
+
+#include "Teuchos_RCP.hpp"
+
+#ifndef HAVE_TEUCHOS_CXX11
+#  error "Teuchos_SlotMap.hpp requires a C++11 compiler"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+
+namespace Teuchos {
+
+
+/** \brief Handle to an object in a <tt>SlotMap</tt>.
+ *
+ * This is just the slot index and the generation of the slot when the
+ * object was inserted (8 bytes).  A default constructed handle is null and
+ * is never valid.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+struct SlotMapHandle {
+  /** \brief . */
+  SlotMapHandle()
+    : index(0), generation(0)
+    {}
+  /** \brief . */
+  SlotMapHandle(std::uint32_t index_in, std::uint32_t generation_in)
+    : index(index_in), generation(generation_in)
+    {}
+  /** \brief . */
+  bool is_null() const
+    {
+      return generation == 0;
+    }
+  /** \brief . */
+  std::uint32_t index;
+  /** \brief . */
+  std::uint32_t generation;
+};
+
+
+/** \brief \relates SlotMapHandle */
+inline bool operator==( const SlotMapHandle &h1, const SlotMapHandle &h2 )
+{
+  return h1.index == h2.index && h1.generation == h2.generation;
+}
+
+
+/** \brief \relates SlotMapHandle */
+inline bool operator!=( const SlotMapHandle &h1, const SlotMapHandle &h2 )
+{
+  return !(h1 == h2);
+}
+
+
+template<class T> class SlotMap;
+
+
+/** \brief Deallocator class that unpins a <tt>SlotMap</tt> slot.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T>
+class SlotMapUnpinDealloc
+{
+public:
+  /// Gives the type (required)
+  typedef T ptr_t;
+  /** \brief . */
+  SlotMapUnpinDealloc(SlotMap<T> &slotMap, std::uint32_t index)
+    : slotMap_(&slotMap), index_(index)
+    {}
+  /// Unpins the slot (required).
+  void free( T* ) { slotMap_->unpin(index_); }
+private:
+  SlotMap<T> *slotMap_;
+  std::uint32_t index_;
+};
+
+
+/** \brief Node class for <tt>RCP</tt> objects returned by
+ * <tt>SlotMap::getRCP()</tt>.
+ *
+ * Each call to <tt>getRCP()</tt> creates its own node for the same object
+ * so a traced node is keyed by its own address (as for an undefined type)
+ * instead of the object's address.
+ *
+ * This is not a general user-level class.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T>
+class SlotMapNodeTmpl : public RCPNodeTmpl<T, SlotMapUnpinDealloc<T> > {
+public:
+  /** \brief . */
+  SlotMapNodeTmpl(T* p, SlotMapUnpinDealloc<T> dealloc, bool has_ownership_in)
+    : RCPNodeTmpl<T, SlotMapUnpinDealloc<T> >(p, TEUCHOS_MOVE(dealloc), has_ownership_in)
+    {}
+#ifdef TEUCHOS_DEBUG
+  /** \brief . */
+  const void* get_base_obj_map_key_void_ptr() const
+    {
+      return 0;
+    }
+  /** \brief . */
+  std::size_t get_node_size() const
+    {
+      return sizeof(*this);
+    }
+#endif
+private:
+  // Not defined and not to be called
+  SlotMapNodeTmpl();
+  SlotMapNodeTmpl(const SlotMapNodeTmpl&);
+  SlotMapNodeTmpl& operator=(const SlotMapNodeTmpl&);
+};
+
+
+/** \brief . */
+template<class T>
+class RCPNodeTmplType<T, SlotMapUnpinDealloc<T>, false> {
+public:
+  /** \brief . */
+  typedef SlotMapNodeTmpl<T> type;
+};
+
+
+/** \brief . */
+template<class T>
+class RCPNodeTmplType<T, SlotMapUnpinDealloc<T>, true> {
+public:
+  /** \brief . */
+  typedef SlotMapNodeTmpl<T> type;
+};
+
+
+/** \brief Container of objects of type <tt>T</tt> addressed through
+ * generational handles.
+ *
+ * This is a cache-friendly alternative to holding a lot of weak
+ * <tt>RCP</tt>s.  A <tt>SlotMapHandle</tt> is 8 bytes, is checked for
+ * validity in O(1) without touching the object, and goes invalid when the
+ * object is erased, even if the slot has been reused since:
+
+ \code
+  SlotMap<Entity> entities;
+  SlotMapHandle h = entities.insert(...);
+  ...
+  if (Entity *e = entities.get(h))
+    e->update();
+  ...
+  entities.for_each([](Entity &e) { e.update(); });
+ \endcode
+
+ * The objects are stored in place in pages of <tt>pageSize</tt> objects.
+ * They never move so pointers to them stay valid until they are erased.
+ * <tt>for_each()</tt> walks the pages in order.  Over-aligned types need a
+ * compiler with aligned <tt>operator new</tt> (C++17).
+ *
+ * A handle can be promoted to a strong <tt>RCP<T></tt> with
+ * <tt>getRCP()</tt>.  While any such <tt>RCP</tt> exists the slot is pinned:
+ * an <tt>erase()</tt> invalidates the handle right away but the object is
+ * only destroyed (and its slot reused) after the last <tt>RCP</tt> is gone.
+ *
+ * The <tt>SlotMap</tt> must outlive all of the <tt>RCP</tt>s that it has
+ * handed out.  This is checked in a debug build.  A <tt>SlotMap</tt> is not
+ * thread safe.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class T>
+class SlotMap {
+public:
+
+  /** \brief Number of objects per page. */
+  static const std::uint32_t pageSize = 1024;
+
+  /** \brief . */
+  SlotMap()
+    : freeHead_(noFreeSlot), size_(0)
+    {}
+
+  /** \brief Destroys all of the objects.
+   *
+   * <b>Preconditions:</b><ul>
+   * <li>No <tt>RCP</tt> from <tt>getRCP()</tt> may be left
+   *     (reported and the program is aborted in a debug build)
+   * </ul>
+   */
+  ~SlotMap()
+    {
+#ifdef TEUCHOS_DEBUG
+      std::size_t numPinned = 0;
+      for (std::size_t i = 0; i < slots_.size(); ++i)
+        numPinned += (slots_[i].pins != 0);
+      TEST_FOR_TERMINATION( numPinned != 0,
+        "Error, ~SlotMap(): " << numPinned << " object(s) are still pinned by"
+        " RCP objects returned from getRCP()!" );
+#endif
+      for (std::uint32_t i = 0; i < slots_.size(); ++i) {
+        if (slots_[i].constructed)
+          ptr(i)->~T();
+      }
+      for (std::size_t k = 0; k < pages_.size(); ++k)
+        freePage(pages_[k]);
+    }
+
+  /** \brief Create a new object and return its handle. */
+  template<class... Args>
+  SlotMapHandle insert( Args&&... args )
+    {
+      std::uint32_t index;
+      if (freeHead_ != noFreeSlot) {
+        index = freeHead_;
+      }
+      else {
+        index = static_cast<std::uint32_t>(slots_.size());
+        if (index / pageSize == pages_.size())
+          addPage();
+        slots_.reserve(slots_.size() + 1);
+      }
+      new (ptr(index)) T(std::forward<Args>(args)...);
+      if (index == slots_.size())
+        slots_.push_back(Slot());
+      else
+        freeHead_ = slots_[index].nextFree;
+      Slot &slot = slots_[index];
+      slot.constructed = true;
+      slot.nextFree = noFreeSlot;
+      ++size_;
+      return SlotMapHandle(index, slot.generation);
+    }
+
+  /** \brief Erase the object for a handle.
+   *
+   * Returns <tt>false</tt> if <tt>h</tt> was not valid.  If the slot is
+   * pinned, destroying the object is delayed until it is unpinned.
+   */
+  bool erase( const SlotMapHandle &h )
+    {
+      if (!contains(h))
+        return false;
+      Slot &slot = slots_[h.index];
+      nextGeneration(slot);
+      --size_;
+      if (slot.pins == 0)
+        destroy(h.index);
+      else
+        slot.nextFree = pinnedErased;
+      return true;
+    }
+
+  /** \brief Return if <tt>h</tt> refers to an object in this map. */
+  bool contains( const SlotMapHandle &h ) const
+    {
+      return h.index < slots_.size()
+        && slots_[h.index].generation == h.generation
+        && slots_[h.index].constructed;
+    }
+
+  /** \brief Return the object for a handle or <tt>0</tt> if it is not
+   * valid. */
+  T* get( const SlotMapHandle &h )
+    {
+      return contains(h) ? ptr(h.index) : 0;
+    }
+
+  /** \brief . */
+  const T* get( const SlotMapHandle &h ) const
+    {
+      return contains(h) ? ptr(h.index) : 0;
+    }
+
+  /** \brief Return a strong <tt>RCP</tt> that pins the object for a handle
+   * or <tt>null</tt> if it is not valid. */
+  RCP<T> getRCP( const SlotMapHandle &h )
+    {
+      if (!contains(h))
+        return null;
+      T *p = ptr(h.index);
+      RCP<T> rcpObj = rcpWithDealloc(p, SlotMapUnpinDealloc<T>(*this, h.index));
+      ++slots_[h.index].pins;
+      return rcpObj;
+    }
+
+  /** \brief Call <tt>func(obj)</tt> for every object in the map. */
+  template<class Func>
+  void for_each( Func func )
+    {
+      for (std::uint32_t i = 0; i < slots_.size(); ++i) {
+        if (slots_[i].constructed && slots_[i].nextFree != pinnedErased)
+          func(*ptr(i));
+      }
+    }
+
+  /** \brief Number of objects in the map (not counting erased objects that
+   * are still pinned). */
+  std::size_t size() const
+    {
+      return size_;
+    }
+
+  /** \brief . */
+  bool empty() const
+    {
+      return size_ == 0;
+    }
+
+private:
+
+  template<class T2> friend class SlotMapUnpinDealloc;
+
+  static const std::uint32_t noFreeSlot = ~std::uint32_t(0);
+  // An erased but still pinned slot has constructed==true and
+  // nextFree==pinnedErased.
+  static const std::uint32_t pinnedErased = noFreeSlot - 1;
+
+  struct Slot {
+    Slot() : generation(1), nextFree(noFreeSlot), pins(0), constructed(false) {}
+    std::uint32_t generation;
+    std::uint32_t nextFree;
+    std::uint32_t pins;
+    bool constructed;
+  };
+
+  struct Storage {
+    alignas(T) unsigned char bytes[sizeof(T)];
+  };
+
+#ifndef __cpp_aligned_new
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+    "SlotMap needs aligned operator new (C++17) for over-aligned types");
+#endif
+
+  std::vector<Slot> slots_;
+  std::vector<Storage*> pages_;
+  std::uint32_t freeHead_;
+  std::size_t size_;
+
+  T* ptr( std::uint32_t index ) const
+    {
+      return reinterpret_cast<T*>(pages_[index / pageSize][index % pageSize].bytes);
+    }
+
+  void addPage()
+    {
+      pages_.reserve(pages_.size() + 1);
+      pages_.push_back(allocatePage());
+    }
+
+  static Storage* allocatePage()
+    {
+      const std::size_t numBytes = pageSize * sizeof(Storage);
+#ifdef __cpp_aligned_new
+      if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        return static_cast<Storage*>(
+          ::operator new(numBytes, std::align_val_t(alignof(T))));
+#endif
+      return static_cast<Storage*>(::operator new(numBytes));
+    }
+
+  static void freePage( Storage *page )
+    {
+#ifdef __cpp_aligned_new
+      if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        ::operator delete(page, std::align_val_t(alignof(T)));
+        return;
+      }
+#endif
+      ::operator delete(page);
+    }
+
+  static void nextGeneration( Slot &slot )
+    {
+      if (++slot.generation == 0)
+        slot.generation = 1;
+    }
+
+  void destroy( std::uint32_t index )
+    {
+      Slot &slot = slots_[index];
+      slot.constructed = false;
+      ptr(index)->~T();
+      slot.nextFree = freeHead_;
+      freeHead_ = index;
+    }
+
+  void unpin( std::uint32_t index )
+    {
+      Slot &slot = slots_[index];
+      if (--slot.pins == 0 && slot.nextFree == pinnedErased)
+        destroy(index);
+    }
+
+  // Not defined and not to be called
+  SlotMap(const SlotMap&);
+  SlotMap& operator=(const SlotMap&);
+
+};
+
+
+} // namespace Teuchos
+
+
+#endif // TEUCHOS_SLOT_MAP_HPP
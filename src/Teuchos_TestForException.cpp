@@ -27,9 +27,34 @@
 // @HEADER
 
 #include "Teuchos_TestForException.hpp"
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+#  include <atomic>
+#endif
 
 
-namespace { int throwNumber = 0; }
+namespace {
+
+
+int throwNumber = 0;
+
+
+void defaultErrorHandler( const char *exceptionName, const std::string &msg )
+{
+  std::cerr
+    << "\nError: " << exceptionName
+    << " (the program will be aborted):\n\n"
+    << msg << std::endl;
+}
+
+
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+std::atomic<TestForException_ErrorHandler> errorHandler(&defaultErrorHandler);
+#else
+TestForException_ErrorHandler errorHandler = &defaultErrorHandler;
+#endif
+
+
+} // namespace
 
 
 void TestForException_incrThrowNumber()
@@ -58,3 +83,68 @@ void TestForException_break( const std::string &errorMsg )
   // function based on a specific value of 'throwNumber' if the exception you
   // want to examine is not the first exception thrown.
 }
+
+
+void Teuchos::TestForExceptionPrivateUtilityPack::appendMsgString(
+  std::ostream &out, const void *msg )
+{
+  out << *static_cast<const std::string*>(msg);
+}
+
+
+std::string Teuchos::TestForExceptionPrivateUtilityPack::formErrorMsg(
+  const char *file, int line, const char *test,
+  AppendMsgFunc appendMsg, const void *msgFunc )
+{
+  TestForException_incrThrowNumber();
+  std::ostringstream omsg;
+  if (file) {
+    omsg
+      << file << ":" << line << ":\n\n"
+      << "Throw number = " << TestForException_getThrowNumber()
+      << "\n\n"
+      << "Throw test that evaluated to true: " << test
+      << "\n\n"
+      << Teuchos::get_backtrace()
+      << "\n";
+    appendMsg(omsg, msgFunc);
+  }
+  else {
+    appendMsg(omsg, msgFunc);
+    omsg << "\n\nThrow number = " << TestForException_getThrowNumber() << "\n\n";
+  }
+  return omsg.str();
+}
+
+
+void Teuchos::TestForExceptionPrivateUtilityPack::abortWithMsg(
+  const char *exceptionName, const char *file, int line, const char *test,
+  AppendMsgFunc appendMsg, const void *msgFunc )
+{
+  const std::string msg = formErrorMsg(file, line, test, appendMsg, msgFunc);
+  TestForException_break(msg);
+  TestForException_abort(exceptionName, msg);
+}
+
+
+TestForException_ErrorHandler
+TestForException_setErrorHandler( TestForException_ErrorHandler handler )
+{
+  if (!handler)
+    handler = &defaultErrorHandler;
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  return errorHandler.exchange(handler);
+#else
+  const TestForException_ErrorHandler oldHandler = errorHandler;
+  errorHandler = handler;
+  return oldHandler;
+#endif
+}
+
+
+void TestForException_abort( const char *exceptionName, const std::string &msg )
+{
+  const TestForException_ErrorHandler handler = errorHandler;
+  handler(exceptionName, msg);
+  std::abort();
+}
@@ -50,6 +50,138 @@ TEUCHOS_LIB_DLL_EXPORT int TestForException_getThrowNumber();
 /** \brief The only purpose for this function is to set a breakpoint. */
 TEUCHOS_LIB_DLL_EXPORT void TestForException_break( const std::string &msg );
 
+/** \brief Function that reports an error in place of throwing an exception
+ * when exceptions are disabled (<tt>TEUCHOS_NO_EXCEPTIONS</tt>) or can not be
+ * thrown (<tt>TEST_FOR_TERMINATION()</tt>).
+ *
+ * \param exceptionName [in] Name of the exception class that would have been
+ * thrown (e.g. <tt>"std::logic_error"</tt>).
+ *
+ * \param msg [in] The full error message that the exception would have
+ * carried.
+ *
+ * The handler should not return.  If it does, the program is aborted anyway.
+ */
+typedef void (*TestForException_ErrorHandler)(
+  const char *exceptionName, const std::string &msg );
+
+/** \brief Set the error handler called by <tt>TestForException_abort()</tt>
+ * and return the previous one.
+ *
+ * Passing <tt>NULL</tt> restores the default handler which writes the
+ * exception name and the message to <tt>std::cerr</tt>.  The handler is
+ * used by <tt>TEST_FOR_TERMINATION()</tt> and, in a build without
+ * exceptions, by all of the macros below.
+ */
+TEUCHOS_LIB_DLL_EXPORT TestForException_ErrorHandler
+TestForException_setErrorHandler( TestForException_ErrorHandler handler );
+
+/** \brief Report an error through the error handler and abort the program.
+ *
+ * This is what the macros below do instead of <tt>throw</tt> in a build
+ * without exceptions.
+ */
+TEUCHOS_NORETURN TEUCHOS_LIB_DLL_EXPORT void TestForException_abort(
+  const char *exceptionName, const std::string &msg );
+
+/** \brief Throw <tt>Exception(msg)</tt>, or pass <tt>msg</tt> to
+ * <tt>TestForException_abort()</tt> in a build without exceptions.
+ */
+#ifndef TEUCHOS_NO_EXCEPTIONS
+#  define TEUCHOS_THROW_EXCEPTION(Exception, msg) throw Exception(msg)
+#else
+#  define TEUCHOS_THROW_EXCEPTION(Exception, msg) \
+  TestForException_abort(#Exception, msg)
+#endif
+
+
+namespace Teuchos {
+namespace TestForExceptionPrivateUtilityPack {
+
+
+// Writes the user part of an error message (stored behind msgFunc) to out
+typedef void (*AppendMsgFunc)( std::ostream &out, const void *msgFunc );
+
+
+// Calls the message lambda created by a TEST_FOR_EXCEPTION macro
+template<class MsgFunc>
+void appendMsgFunc( std::ostream &out, const void *msgFunc )
+{
+  (*static_cast<const MsgFunc*>(msgFunc))(out);
+}
+
+
+// Writes the already formed message given as a std::string
+TEUCHOS_LIB_DLL_EXPORT void appendMsgString( std::ostream &out, const void *msg );
+
+
+// Increments the throw number and forms the full error message, with the
+// file, line, test and backtrace in front of the user part (or just the
+// throw number after it when file==0).
+TEUCHOS_COLD TEUCHOS_LIB_DLL_EXPORT std::string formErrorMsg(
+  const char *file, int line, const char *test,
+  AppendMsgFunc appendMsg, const void *msgFunc );
+
+
+// Out of line and cold so that a check only costs the test and a branch at
+// the call site.  There is one of these for each exception type.
+template<class Exception>
+TEUCHOS_NORETURN TEUCHOS_NOINLINE TEUCHOS_COLD
+void throwException( const char *exceptionName,
+  const char *file, int line, const char *test,
+  AppendMsgFunc appendMsg, const void *msgFunc )
+{
+  const std::string msg = formErrorMsg(file, line, test, appendMsg, msgFunc);
+  TestForException_break(msg);
+#ifndef TEUCHOS_NO_EXCEPTIONS
+  throw Exception(msg);
+#else
+  TestForException_abort(exceptionName, msg);
+#endif
+}
+
+
+// Same as throwException() but always reports the error through
+// TestForException_abort(), for checks in code that must not throw.
+TEUCHOS_NORETURN TEUCHOS_NOINLINE TEUCHOS_COLD TEUCHOS_LIB_DLL_EXPORT
+void abortWithMsg( const char *exceptionName,
+  const char *file, int line, const char *test,
+  AppendMsgFunc appendMsg, const void *msgFunc );
+
+
+} // namespace TestForExceptionPrivateUtilityPack
+} // namespace Teuchos
+
+
+// Used by the macros below to report a failed test with report(), which is
+// one of the cold helpers above.  msg is only evaluated inside of report()
+// (through a lambda) when C++11 is available.
+#ifdef HAVE_TEUCHOS_CXX11
+#  define TEUCHOS_TEST_FOR_EXCEPTION_REPORT(report, exceptionName, file, test, msg) \
+  { \
+    const auto teuchosMsgFunc = [&](std::ostream &omsg) { omsg << msg; }; \
+    report( exceptionName, file, __LINE__, test, \
+      &Teuchos::TestForExceptionPrivateUtilityPack::appendMsgFunc< \
+        decltype(teuchosMsgFunc)>, \
+      &teuchosMsgFunc ); \
+  }
+#else
+#  define TEUCHOS_TEST_FOR_EXCEPTION_REPORT(report, exceptionName, file, test, msg) \
+  { \
+    std::ostringstream omsg; \
+    omsg << msg; \
+    const std::string teuchosMsg = omsg.str(); \
+    report( exceptionName, file, __LINE__, test, \
+      &Teuchos::TestForExceptionPrivateUtilityPack::appendMsgString, \
+      &teuchosMsg ); \
+  }
+#endif
+
+#define TEUCHOS_TEST_FOR_EXCEPTION_THROW(file, test, Exception, msg) \
+  TEUCHOS_TEST_FOR_EXCEPTION_REPORT( \
+    Teuchos::TestForExceptionPrivateUtilityPack::throwException<Exception>, \
+    #Exception, file, test, msg)
+
 /** \brief Macro for throwing an exception with breakpointing to ease debugging
  *
  * \param throw_exception_test [in] Test for when to throw the exception.
@@ -117,26 +249,17 @@ TEUCHOS_LIB_DLL_EXPORT void TestForException_break( const std::string &msg );
  * reguardless if the test fails and the exception is thrown or
  * not. Therefore, it is safe to call a function with side-effects as the
  * <tt>throw_exception_test</tt> argument.
+ *
+ * Only the test and a branch are expanded inline.  The error message is
+ * formed and the exception thrown in an out-of-line function that the
+ * compiler keeps away from the hot code.
  */
 #define TEST_FOR_EXCEPTION(throw_exception_test, Exception, msg) \
 { \
     const bool throw_exception = (throw_exception_test); \
-    if(throw_exception) { \
-        TestForException_incrThrowNumber(); \
-        std::ostringstream omsg; \
-        omsg \
-            << __FILE__ << ":" << __LINE__ << ":\n\n" \
-            << "Throw number = " << TestForException_getThrowNumber() \
-            << "\n\n" \
-            << "Throw test that evaluated to true: "#throw_exception_test \
-            << "\n\n" \
-            << Teuchos::get_backtrace() \
-            << "\n" \
-            << msg; \
-        const std::string &omsgstr = omsg.str(); \
-        TestForException_break(omsgstr); \
-        throw Exception(omsgstr); \
-    } \
+    if(TEUCHOS_UNLIKELY(throw_exception)) \
+      TEUCHOS_TEST_FOR_EXCEPTION_THROW(__FILE__, #throw_exception_test, \
+        Exception, msg) \
 }
 
 
@@ -189,15 +312,29 @@ TEUCHOS_LIB_DLL_EXPORT void TestForException_break( const std::string &msg );
 #define TEST_FOR_EXCEPTION_PURE_MSG(throw_exception_test, Exception, msg) \
 { \
     const bool throw_exception = (throw_exception_test); \
-    if(throw_exception) { \
-      TestForException_incrThrowNumber(); \
-      std::ostringstream omsg; \
-	    omsg << msg; \
-      omsg << "\n\nThrow number = " << TestForException_getThrowNumber() << "\n\n"; \
-      const std::string &omsgstr = omsg.str(); \
-      TestForException_break(omsgstr); \
-      throw Exception(omsgstr); \
-    } \
+    if(TEUCHOS_UNLIKELY(throw_exception)) \
+      TEUCHOS_TEST_FOR_EXCEPTION_THROW(0, 0, Exception, msg) \
+}
+
+/** \brief Macro for reporting an error and aborting the program where an
+ * exception can not be thrown (e.g. in a destructor).
+ *
+ * \param terminate_test [in] Test for when to abort.  It is included
+ * verbatim in the error message.
+ *
+ * \param msg [in] Error message as for <tt>TEST_FOR_EXCEPTION()</tt>.
+ *
+ * The message is formed just like for <tt>TEST_FOR_EXCEPTION()</tt> and is
+ * passed to <tt>TestForException_abort()</tt> (which calls the error handler
+ * and then <tt>std::abort()</tt>) instead of being thrown.
+ */
+#define TEST_FOR_TERMINATION(terminate_test, msg) \
+{ \
+    const bool terminate = (terminate_test); \
+    if(TEUCHOS_UNLIKELY(terminate)) \
+      TEUCHOS_TEST_FOR_EXCEPTION_REPORT( \
+        Teuchos::TestForExceptionPrivateUtilityPack::abortWithMsg, \
+        "std::logic_error", __FILE__, #terminate_test, msg) \
 }
 
 /** \brief This macro is designed to be a short version of
@@ -241,6 +378,7 @@ TEUCHOS_LIB_DLL_EXPORT void TestForException_break( const std::string &msg );
  * receive a printout of a line of output that gives the exception type and
  * the error message that is generated.
  */
+#ifndef TEUCHOS_NO_EXCEPTIONS
 #define TEST_FOR_EXCEPTION_PRINT(throw_exception_test, Exception, msg, out_ptr) \
 try { \
   TEST_FOR_EXCEPTION(throw_exception_test,Exception,msg); \
@@ -254,6 +392,11 @@ catch(const std::exception &except) { \
   } \
   throw; \
 }
+#else
+// The error handler reports the error before the program is aborted
+#define TEST_FOR_EXCEPTION_PRINT(throw_exception_test, Exception, msg, out_ptr) \
+  TEST_FOR_EXCEPTION(throw_exception_test,Exception,msg)
+#endif
 
 /** \brief This macro is the same as <tt>TEST_FOR_EXCEPT()</tt> except that the
  * exception will be caught, the message printed, and then rethrown.
@@ -278,7 +421,7 @@ catch(const std::exception &except) { \
   std::ostringstream omsg; \
 	omsg << exc.what() << std::endl \
        << "caught in " << __FILE__ << ":" << __LINE__ << std::endl ; \
-  throw std::runtime_error(omsg.str()); \
+  TEUCHOS_THROW_EXCEPTION(std::runtime_error, omsg.str()); \
 }
 
 
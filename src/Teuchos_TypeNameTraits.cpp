@@ -32,11 +32,44 @@
 // Define this if you want to fource name demangling if supported
 //#define HAVE_TEUCHOS_DEMANGLE
 
+#include <map>
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+#  include <mutex>
+#endif
+
 #if defined(HAVE_GCC_ABI_DEMANGLE) && defined(HAVE_TEUCHOS_DEMANGLE)
 #  include <cxxabi.h>
 #endif
 
 
+namespace {
+
+
+typedef std::map<const char*, std::string> demangle_cache_t;
+
+
+demangle_cache_t& demangle_cache()
+{
+  // Never deleted so that names can still be looked up while static objects
+  // are being destroyed.
+  static demangle_cache_t *s_demangle_cache = new demangle_cache_t;
+  return *s_demangle_cache;
+}
+
+
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+std::mutex& demangle_cache_mutex()
+{
+  // Never deleted (see demangle_cache())
+  static std::mutex *s_demangle_cache_mutex = new std::mutex;
+  return *s_demangle_cache_mutex;
+}
+#endif
+
+
+} // namespace
+
+
 std::string Teuchos::demangleName( const std::string &mangledName )
 {
 #if defined(HAVE_GCC_ABI_DEMANGLE) && defined(HAVE_TEUCHOS_DEMANGLE)
@@ -64,3 +97,19 @@ std::string Teuchos::demangleName( const std::string &mangledName )
   return mangledName;
 #endif
 }
+
+
+const std::string& Teuchos::demangleNameCached( const char *mangledName )
+{
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  std::lock_guard<std::mutex> lock(demangle_cache_mutex());
+#endif
+  demangle_cache_t &cache = demangle_cache();
+  demangle_cache_t::iterator itr = cache.find(mangledName);
+  if (itr == cache.end()) {
+    // std::map never moves its elements so the reference stays valid
+    itr = cache.insert(
+      demangle_cache_t::value_type(mangledName, demangleName(mangledName))).first;
+  }
+  return itr->second;
+}
@@ -35,6 +35,9 @@
 */
 
 #include "Teuchos_ConstTypeTraits.hpp"
+#ifdef HAVE_TEUCHOS_CONSTEXPR_TYPE_NAME
+#  include "Teuchos_ConstexprTypeName.hpp"
+#endif
 
 #if defined(__IBMCPP__) && __IBMCPP__ < 900
 # define TEUCHOS_TYPE_NAME_TRAITS_OLD_IBM
@@ -53,7 +56,27 @@ namespace  Teuchos {
 TEUCHOS_LIB_DLL_EXPORT std::string demangleName( const std::string &mangledName );
 
 
+/** \brief Demangle a C++ name only once.
+ *
+ * <tt>mangledName</tt> must be the pointer returned by
+ * <tt>typeid(...).name()</tt>.  The pointer is the key of a global cache so
+ * each type is demangled at most once.  The returned reference stays valid
+ * until the program exits.  The cache is thread safe in a thread-safe build.
+ *
+ * \ingroup teuchos_language_support_grp
+ */
+TEUCHOS_LIB_DLL_EXPORT const std::string& demangleNameCached( const char *mangledName );
+
+
 /** \brief Default traits class that just returns <tt>typeid(T).name()</tt>.
+ *
+ * The demangled names are cached (see <tt>demangleNameCached()</tt>) and
+ * returned by reference so that repeated calls neither demangle nor copy.
+ * If the compiler supports it, <tt>name()</tt> is taken from
+ * <tt>constexprTypeName()</tt> instead and nothing is demangled at all.
+ * <tt>concreteName()</tt> then returns <tt>name()</tt> as well when the
+ * dynamic type of the object is <tt>T</tt>, so both give the same spelling
+ * for the same type, and only demangles the names of derived types.
  *
  * \ingroup teuchos_language_support_grp
  */
@@ -61,19 +84,32 @@ template<typename T>
 class TypeNameTraits {
 public:
   /** \brief . */
-  static std::string name()
+  static const std::string& name()
     {
-      return demangleName(typeid(T).name());
+#ifdef HAVE_TEUCHOS_CONSTEXPR_TYPE_NAME
+      static const std::string *s_name =
+        new std::string(constexprTypeName<T>());
+      return *s_name;
+#else
+      static const std::string &s_name = demangleNameCached(typeid(T).name());
+      return s_name;
+#endif
     }
   /** \brief . */
 #ifndef TEUCHOS_TYPE_NAME_TRAITS_OLD_IBM
-  static std::string concreteName( const T& t )
+  static const std::string& concreteName( const T& t )
 #else
   // the IBM compilers on AIX have a problem with const
-  static std::string concreteName( T t )
+  static const std::string& concreteName( T t )
 #endif
     {
-      return demangleName(typeid(t).name());
+#ifdef HAVE_TEUCHOS_CONSTEXPR_TYPE_NAME
+      // Use the same spelling as name() for the static type (the demangled
+      // name would include default template arguments)
+      if (typeid(t) == typeid(T))
+        return name();
+#endif
+      return demangleNameCached(typeid(t).name());
     }
 };
 
@@ -88,7 +124,13 @@ public:
  * \ingroup teuchos_language_support_grp
  */
 template<typename T>
+#ifdef HAVE_TEUCHOS_CXX11
+// Return by reference when the traits class does
+auto typeName( const T &t )
+  -> decltype(TypeNameTraits<typename ConstTypeTraits<T>::NonConstType>::concreteName(t))
+#else
 std::string typeName( const T &t )
+#endif
 {
   typedef typename ConstTypeTraits<T>::NonConstType ncT;
 #ifndef TEUCHOS_TYPE_NAME_TRAITS_OLD_IBM
@@ -111,7 +153,12 @@ std::string typeName( const T &t )
  * \ingroup teuchos_language_support_grp
  */
 template<typename T>
+#ifdef HAVE_TEUCHOS_CXX11
+auto concreteTypeName( const T &t )
+  -> decltype(TypeNameTraits<typename ConstTypeTraits<T>::NonConstType>::concreteName(t))
+#else
 std::string concreteTypeName( const T &t )
+#endif
 {
   typedef typename ConstTypeTraits<T>::NonConstType ncT;
   return TypeNameTraits<ncT>::concreteName(t);
@@ -122,8 +169,9 @@ std::string concreteTypeName( const T &t )
 template<> \
 class TEUCHOS_LIB_DLL_EXPORT TypeNameTraits<TYPE> { \
 public: \
-  static std::string name() { return (#TYPE); } \
-  static std::string concreteName(const TYPE&) { return name(); } \
+  static const std::string& name() \
+    { static const std::string *s_name = new std::string(#TYPE); return *s_name; } \
+  static const std::string& concreteName(const TYPE&) { return name(); } \
 } \
 
 TEUCHOS_TYPE_NAME_TRAITS_BUILTIN_TYPE_SPECIALIZATION(bool);
@@ -139,16 +187,22 @@ template<typename T>
 class TEUCHOS_LIB_DLL_EXPORT TypeNameTraits<T*> {
 public:
   typedef T* T_ptr;
-  static std::string name() { return TypeNameTraits<T>::name() + "*"; }
-  static std::string concreteName(T_ptr) { return name(); }
+  static const std::string& name()
+    {
+      static const std::string *s_name =
+        new std::string(TypeNameTraits<T>::name() + "*");
+      return *s_name;
+    }
+  static const std::string& concreteName(T_ptr) { return name(); }
 };
 
 
 template<>
 class TEUCHOS_LIB_DLL_EXPORT TypeNameTraits<std::string> {
 public:
-  static std::string name() { return "string"; }
-  static std::string concreteName(const std::string&)
+  static const std::string& name()
+    { static const std::string *s_name = new std::string("string"); return *s_name; }
+  static const std::string& concreteName(const std::string&)
     { return name(); }
 };
 
@@ -156,8 +210,9 @@ public:
 template<>
 class TEUCHOS_LIB_DLL_EXPORT TypeNameTraits<void*> {
 public:
-  static std::string name() { return "void*"; }
-  static std::string concreteName(const std::string&) { return name(); }
+  static const std::string& name()
+    { static const std::string *s_name = new std::string("void*"); return *s_name; }
+  static const std::string& concreteName(const std::string&) { return name(); }
 };
 
 
@@ -167,9 +222,13 @@ public:
 template<typename T>
 class TEUCHOS_LIB_DLL_EXPORT TypeNameTraits<std::complex<T> > {
 public:
-  static std::string name()
-    { return "complex<"+TypeNameTraits<T>::name()+">"; }
-  static std::string concreteName(const std::complex<T>&)
+  static const std::string& name()
+    {
+      static const std::string *s_name =
+        new std::string("complex<"+TypeNameTraits<T>::name()+">");
+      return *s_name;
+    }
+  static const std::string& concreteName(const std::complex<T>&)
     { return name(); }
 };
 
@@ -0,0 +1,367 @@
+// @HEADER
+// ***********************************************************************
+// 
+//                    Teuchos: Common Tools Package
+//                 Copyright (2004) Sandia Corporation
+// 
+// Under terms of Contract DE-AC04-94AL85000, there is a non-exclusive
+// license for use of this work by or on behalf of the U.S. Government.
+// 
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as
+// published by the Free Software Foundation; either version 2.1 of the
+// License, or (at your option) any later version.
+//  
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//  
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+// Questions? Contact Michael A. Heroux (maherou@sandia.gov) 
+// 
+// ***********************************************************************
+// @HEADER
+
+#ifndef TEUCHOS_WEAK_RCP_CACHE_HPP
+#define TEUCHOS_WEAK_RCP_CACHE_HPP
+
+
+/** \file Teuchos_WeakRCPCache.hpp
+ *
+ * \brief Concurrent cache of objects that are only kept while some client
+ * holds a strong RCP to them.
+ */
+
+
+#include "Teuchos_RCP.hpp"
+
+#ifndef HAVE_TEUCHOS_CXX11
+#  error "Teuchos_WeakRCPCache.hpp requires a C++11 compiler"
+#endif
+
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+
+namespace Teuchos {
+
+
+/** \brief Concurrent, sharded map from keys to weakly held
+ * <tt>RCP<T></tt> objects.
+ *
+ * This is a deduplicating cache: the first object inserted for a key is
+ * handed out to everyone that asks for that key for as long as any client
+ * holds a strong RCP to it.  The cache itself only holds weak RCPs so it
+ * never keeps an object alive:
+
+ \code
+  WeakRCPCache<std::string, const Mesh> meshCache;
+
+  RCP<const Mesh> getMesh(const std::string &fileName)
+  {
+    return meshCache.getOrCreate(fileName,
+      [&]() { return readMesh(fileName); });
+  }
+ \endcode
+
+ * A hit promotes the weak RCP with <tt>RCP::create_strong_thread_safe()</tt>
+ * which fails cleanly if the last strong reference is being released at the
+ * same time.  When the last strong reference to a cached object goes away,
+ * its entry is removed right away by a destruction callback attached to the
+ * object's node (see <tt>add_destroy_callback()</tt>) so dead entries do not
+ * pile up.  Each entry owns its callback and detaches it again when the entry
+ * is erased or replaced, so an object that outlives many cache entries does
+ * not collect callbacks.
+ *
+ * The keys are spread over independently locked shards so threads looking
+ * up different keys rarely contend.  The locks are never held while an
+ * object is created or destroyed.
+ *
+ * <b>Warning!</b> Using the cache (or any RCP) from several threads requires
+ * Teuchos to be configured with <tt>TEUCHOS_ENABLE_THREAD_SAFE=ON</tt>.
+ *
+ * \ingroup teuchos_mem_mng_grp
+ */
+template<class K, class T, class Hash = std::hash<K>,
+  class KeyEqual = std::equal_to<K> >
+class WeakRCPCache {
+public:
+
+  /** \brief . */
+  typedef K key_type;
+  /** \brief . */
+  typedef T element_type;
+
+  /** \brief Construct an empty cache with <tt>numShards</tt> shards. */
+  explicit WeakRCPCache(int numShards = 16);
+
+  /** \brief Destroying the cache does not affect the cached objects. */
+  ~WeakRCPCache();
+
+  /** \brief Return the live object for <tt>key</tt> or <tt>null</tt>. */
+  RCP<T> get(const K &key) const;
+
+  /** \brief Insert <tt>obj</tt> for <tt>key</tt> unless there already is a
+   * live object for it.
+   *
+   * \returns The live object for <tt>key</tt>, which is <tt>obj</tt> unless
+   * another object was already cached.
+   *
+   * <b>Preconditions:</b><ul>
+   * <li><tt>nonnull(obj) && obj.strength() == RCP_STRONG</tt>
+   * </ul>
+   */
+  RCP<T> insert(const K &key, const RCP<T> &obj);
+
+  /** \brief Return the live object for <tt>key</tt>, creating it with
+   * <tt>factory()</tt> if there is none.
+   *
+   * The factory is called without holding any lock.  If two threads miss on
+   * the same key at the same time, both call the factory and the object from
+   * the first to insert is returned to both.
+   */
+  template<class Factory>
+  RCP<T> getOrCreate(const K &key, Factory factory);
+
+  /** \brief Remove the entry for <tt>key</tt> and return if there was one.
+   *
+   * This does not affect the object itself.
+   */
+  bool erase(const K &key);
+
+  /** \brief Remove all entries. */
+  void clear();
+
+  /** \brief Number of entries, including entries whose object is being
+   * destroyed right now. */
+  std::size_t size() const;
+
+private:
+
+  class DestroyHook;
+
+  // The weak RCP and the hook attached to its node for this entry
+  struct Entry {
+    Entry() : hook(0) {}
+    RCP<T> obj;
+    DestroyHook *hook;
+  };
+
+  typedef std::unordered_map<K, Entry, Hash, KeyEqual> map_t;
+
+  struct Shard {
+    mutable std::mutex mutex;
+    map_t entries;
+  };
+
+  // Held by an RCP so that the destruction hooks can detect that the cache
+  // itself is gone.
+  struct State {
+    explicit State(int numShards) : shards(numShards) {}
+    std::vector<Shard> shards;
+    Hash hash;
+    Shard& shard(const K &key)
+      { return shards[hash(key) % shards.size()]; }
+  };
+
+  // Removes the entry for key_ when the cached object is deleted unless it
+  // has been replaced by another object already.
+  class DestroyHook : public RCPNodeDestroyCallback {
+  public:
+    DestroyHook(const RCP<State> &state, const K &key, const RCPNode *node)
+      : state_(state.create_weak()), key_(key), node_(node)
+      {}
+    void on_destroy(EPrePostDestruction)
+      {
+        remove_entry();
+        delete this;
+      }
+  private:
+    RCP<State> state_;
+    K key_;
+    const RCPNode *node_;
+    void remove_entry()
+      {
+        const RCP<State> state = state_.create_strong_thread_safe();
+        if (is_null(state))
+          return; // The cache is already gone
+        RCP<T> deadEntry; // Released after the lock
+        Shard &shard = state->shard(key_);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const typename map_t::iterator itr = shard.entries.find(key_);
+        if (itr != shard.entries.end()
+          && itr->second.obj.access_private_node().node_ptr() == node_)
+        {
+          deadEntry.swap(itr->second.obj);
+          shard.entries.erase(itr);
+        }
+      }
+  };
+
+  RCP<State> state_;
+
+  static RCP<T> promote(const map_t &entries, const K &key);
+
+  static void detach_hook(Entry &entry);
+
+  // Not defined and not to be called
+  WeakRCPCache(const WeakRCPCache&);
+  WeakRCPCache& operator=(const WeakRCPCache&);
+
+};
+
+
+// Implementations
+
+
+template<class K, class T, class Hash, class KeyEqual>
+WeakRCPCache<K,T,Hash,KeyEqual>::WeakRCPCache(int numShards)
+{
+  TEST_FOR_EXCEPTION( numShards < 1, std::invalid_argument,
+    "WeakRCPCache: numShards = " << numShards << " must be positive!" );
+  state_ = rcp(new State(numShards));
+}
+
+
+template<class K, class T, class Hash, class KeyEqual>
+WeakRCPCache<K,T,Hash,KeyEqual>::~WeakRCPCache()
+{
+  // Release the weak entries before the hooks can no longer get to them
+  clear();
+}
+
+
+template<class K, class T, class Hash, class KeyEqual>
+RCP<T> WeakRCPCache<K,T,Hash,KeyEqual>::get(const K &key) const
+{
+  Shard &shard = state_->shard(key);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return promote(shard.entries, key);
+}
+
+
+template<class K, class T, class Hash, class KeyEqual>
+RCP<T> WeakRCPCache<K,T,Hash,KeyEqual>::insert(const K &key, const RCP<T> &obj)
+{
+  TEST_FOR_EXCEPTION( is_null(obj) || obj.strength() != RCP_STRONG,
+    std::invalid_argument,
+    "WeakRCPCache::insert(...): Error, the object must be a non-null strong"
+    " RCP!" );
+  Shard &shard = state_->shard(key);
+  RCP<T> oldEntry; // Released after the lock
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  RCP<T> existing = promote(shard.entries, key);
+  if (nonnull(existing))
+    return existing;
+  // The caller's strong reference keeps obj alive while the hook is attached
+  // so the hook can not be called before it is in the entry.
+  DestroyHook *hook =
+    new DestroyHook(state_, key, obj.access_private_node().node_ptr());
+  TEUCHOS_TRY {
+    add_destroy_callback(obj, *hook, PRE_DESTROY);
+  }
+  TEUCHOS_CATCH_ALL {
+    delete hook;
+    TEUCHOS_RETHROW;
+  }
+  Entry &entry = shard.entries[key];
+  detach_hook(entry);
+  oldEntry.swap(entry.obj);
+  entry.obj = obj.create_weak();
+  entry.hook = hook;
+  return obj;
+}
+
+
+template<class K, class T, class Hash, class KeyEqual>
+template<class Factory>
+RCP<T> WeakRCPCache<K,T,Hash,KeyEqual>::getOrCreate(const K &key,
+  Factory factory)
+{
+  const RCP<T> existing = get(key);
+  if (nonnull(existing))
+    return existing;
+  return insert(key, factory());
+}
+
+
+template<class K, class T, class Hash, class KeyEqual>
+bool WeakRCPCache<K,T,Hash,KeyEqual>::erase(const K &key)
+{
+  Shard &shard = state_->shard(key);
+  RCP<T> oldEntry; // Released after the lock
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const typename map_t::iterator itr = shard.entries.find(key);
+  if (itr == shard.entries.end())
+    return false;
+  detach_hook(itr->second);
+  oldEntry.swap(itr->second.obj);
+  shard.entries.erase(itr);
+  return true;
+}
+
+
+template<class K, class T, class Hash, class KeyEqual>
+void WeakRCPCache<K,T,Hash,KeyEqual>::clear()
+{
+  typedef typename std::vector<Shard>::iterator itr_t;
+  for (itr_t itr = state_->shards.begin(); itr != state_->shards.end(); ++itr) {
+    map_t oldEntries; // Released after the lock
+    std::lock_guard<std::mutex> lock(itr->mutex);
+    typedef typename map_t::iterator entry_itr_t;
+    for (entry_itr_t entry = itr->entries.begin(); entry != itr->entries.end();
+      ++entry)
+    {
+      detach_hook(entry->second);
+    }
+    oldEntries.swap(itr->entries);
+  }
+}
+
+
+template<class K, class T, class Hash, class KeyEqual>
+std::size_t WeakRCPCache<K,T,Hash,KeyEqual>::size() const
+{
+  std::size_t numEntries = 0;
+  typedef typename std::vector<Shard>::const_iterator itr_t;
+  for (itr_t itr = state_->shards.begin(); itr != state_->shards.end(); ++itr) {
+    std::lock_guard<std::mutex> lock(itr->mutex);
+    numEntries += itr->entries.size();
+  }
+  return numEntries;
+}
+
+
+template<class K, class T, class Hash, class KeyEqual>
+RCP<T> WeakRCPCache<K,T,Hash,KeyEqual>::promote(const map_t &entries,
+  const K &key)
+{
+  const typename map_t::const_iterator itr = entries.find(key);
+  if (itr == entries.end())
+    return null;
+  return itr->second.obj.create_strong_thread_safe();
+}
+
+
+// Must be called while holding the lock of the entry's shard.  If the hook
+// can not be unregistered it is being called (the object is being destroyed)
+// and it deletes itself.
+template<class K, class T, class Hash, class KeyEqual>
+void WeakRCPCache<K,T,Hash,KeyEqual>::detach_hook(Entry &entry)
+{
+  if (entry.hook && entry.hook->unregister())
+    delete entry.hook;
+  entry.hook = 0;
+}
+
+
+} // namespace Teuchos
+
+
+#endif // TEUCHOS_WEAK_RCP_CACHE_HPP
@@ -0,0 +1,48 @@
+// @HEADER
+// ***********************************************************************
+// 
+//                    Teuchos: Common Tools Package
+//                 Copyright (2004) Sandia Corporation
+// 
+// Under terms of Contract DE-AC04-94AL85000, there is a non-exclusive
+// license for use of this work by or on behalf of the U.S. Government.
+// 
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as
+// published by the Free Software Foundation; either version 2.1 of the
+// License, or (at your option) any later version.
+//  
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//  
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+// Questions? Contact Michael A. Heroux (maherou@sandia.gov) 
+// 
+// ***********************************************************************
+// @HEADER
+
+#include "Teuchos_any.hpp"
+
+
+TEUCHOS_NORETURN TEUCHOS_COLD
+void Teuchos::any_cast_throw_exception(
+  const std::string &ValueTypeName, const any &operand
+  )
+{
+  TEST_FOR_EXCEPTION(
+    operand.empty(), bad_any_cast
+    ,"any_cast<"<<ValueTypeName<<">(operand): Error, cast to type "
+    << "any::holder<"<<ValueTypeName<<"> failed because the content is NULL"
+    );
+  TEST_FOR_EXCEPTION(
+    true, bad_any_cast
+    ,"any_cast<"<<ValueTypeName<<">(operand): Error, cast to type "
+    << "any::holder<"<<ValueTypeName<<"> failed since the actual underlying type is \'"
+    << typeName(*operand.access_content()) << "!"
+    );
+}
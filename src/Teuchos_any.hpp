@@ -7,6 +7,11 @@
 
 #include "Teuchos_TestForException.hpp"
 #include "Teuchos_TypeNameTraits.hpp"
+#include <new>
+#ifdef HAVE_TEUCHOS_CXX11
+#  include <type_traits>
+#  include <utility>
+#endif
 
 //
 // This file was taken from the boost library which contained the
@@ -39,39 +44,94 @@ namespace Teuchos {
 
 /** \brief Modified boost::any class, which is a container for a templated
  * value.
+ *
+ * Small values that can be moved without throwing (e.g. <tt>RCP</tt>
+ * objects, integers and pointers) are stored inline in the <tt>any</tt>
+ * object itself so that storing them does not allocate any memory.  Larger
+ * values are stored on the heap.  With a C++11 compiler, <tt>any</tt>
+ * objects and the values stored in them can be moved instead of copied.
  */
 class TEUCHOS_LIB_DLL_EXPORT any
 {
 public:
   //! Empty constructor
   any()
-    : content(0)
+    : content(0), tag(0)
     {}
 
+#ifdef HAVE_TEUCHOS_CXX11
+  //! Templated constructor
+  template<typename ValueType,
+    typename = typename std::enable_if<
+      !std::is_same<typename std::decay<ValueType>::type, any>::value>::type>
+  explicit any(ValueType && value)
+    : content(0), tag(type_tag<typename std::decay<ValueType>::type>())
+    {
+      create<typename std::decay<ValueType>::type>(
+        std::forward<ValueType>(value));
+    }
+#else
   //! Templated constructor
   template<typename ValueType>
   explicit any(const ValueType & value)
-    : content(new holder<ValueType>(value))
-    {}
+    : content(0), tag(type_tag<ValueType>())
+    {
+      create<ValueType>(value);
+    }
+#endif
   
   //! Copy constructor
   any(const any & other)
-    : content(other.content ? other.content->clone() : 0)
-    {}
+    : content(0), tag(other.tag)
+    {
+      if (other.is_inline())
+        content = other.content->clone_into(&storage);
+      else if (other.content)
+        content = other.content->clone();
+    }
+
+#ifdef HAVE_TEUCHOS_CXX11
+  //! Move constructor (leaves <tt>other</tt> empty)
+  any(any && other) noexcept
+    : content(0), tag(0)
+    {
+      move_from(other);
+    }
+#endif
 
   //! Destructor
   ~any()
     {
-      delete content;
+      destroy();
     }
 
   //! Method for swapping the contents of two any classes
   any & swap(any & rhs)
     {
-      std::swap(content, rhs.content);
+      if (!this->is_inline() && !rhs.is_inline()) {
+        std::swap(content, rhs.content);
+        std::swap(tag, rhs.tag);
+      }
+      else {
+        any tmp;
+        tmp.move_from(rhs);
+        rhs.move_from(*this);
+        this->move_from(tmp);
+      }
       return *this;
     }
   
+#ifdef HAVE_TEUCHOS_CXX11
+  //! Copy or move the value <tt>rhs</tt>
+  template<typename ValueType>
+  typename std::enable_if<
+    !std::is_same<typename std::decay<ValueType>::type, any>::value, any&>::type
+  operator=(ValueType && rhs)
+    {
+      any(std::forward<ValueType>(rhs)).swap(*this);
+      return *this;
+    }
+#else
   //! Copy the value <tt>rhs</tt>
   template<typename ValueType>
   any & operator=(const ValueType & rhs)
@@ -79,6 +139,7 @@ public:
       any(rhs).swap(*this);
       return *this;
     }
+#endif
   
   //! Copy the value held in <tt>rhs</tt>
   any & operator=(const any & rhs)
@@ -86,6 +147,18 @@ public:
       any(rhs).swap(*this);
       return *this;
     }
+
+#ifdef HAVE_TEUCHOS_CXX11
+  //! Move the value held in <tt>rhs</tt> (leaves <tt>rhs</tt> empty)
+  any & operator=(any && rhs) noexcept
+    {
+      if (this != &rhs) {
+        destroy();
+        move_from(rhs);
+      }
+      return *this;
+    }
+#endif
   
   //! Return true if nothing is being stored
   bool empty() const
@@ -115,7 +188,22 @@ public:
       else if( !this->empty() && other.empty() )
         return false;
       // !this->empty() && !other.empty()
-      return content->same(*other.content);
+      if( tag != other.tag && type() != other.type() )
+        return false;
+      return content->same_value(*other.content);
+    }
+
+  /** \brief Return true if the stored value is of type <tt>ValueType</tt>.
+   *
+   * The common case is a single pointer comparison of type tags.  Only if
+   * the tags differ (e.g. because the value was stored by another shared
+   * library) are the <tt>std::type_info</tt> objects compared.
+   */
+  template<typename ValueType>
+  bool holds() const
+    {
+      return tag == type_tag<ValueType>()
+        || (content && content->type() == typeid(ValueType));
     }
 
   //! Print this value to the output stream <tt>os</tt>
@@ -140,8 +228,14 @@ public:
     virtual std::string typeName() const = 0;
     /** \brief . */
     virtual placeholder * clone() const = 0;
+    /** \brief Copy construct into the inline storage at <tt>buf</tt>. */
+    virtual placeholder * clone_into(void *buf) const = 0;
+    /** \brief Move construct into the inline storage at <tt>buf</tt>. */
+    virtual placeholder * move_into(void *buf) = 0;
     /** \brief . */
     virtual bool same( const placeholder &other ) const = 0;
+    /** \brief Compare values, <tt>other</tt> must hold the same type. */
+    virtual bool same_value( const placeholder &other ) const = 0;
     /** \brief . */
     virtual void print(std::ostream & os) const = 0;
   };
@@ -155,6 +249,12 @@ public:
     holder(const ValueType & value)
       : held(value)
       {}
+#ifdef HAVE_TEUCHOS_CXX11
+    /** \brief . */
+    holder(ValueType && value)
+      : held(std::move(value))
+      {}
+#endif
     /** \brief . */
     const std::type_info & type() const
       { return typeid(ValueType); }
@@ -165,15 +265,30 @@ public:
     placeholder * clone() const
       { return new holder(held); }
     /** \brief . */
+    placeholder * clone_into(void *buf) const
+      { return new (buf) holder(held); }
+    /** \brief . */
+    placeholder * move_into(void *buf)
+      {
+#ifdef HAVE_TEUCHOS_CXX11
+        return new (buf) holder(std::move(held));
+#else
+        return new (buf) holder(held);
+#endif
+      }
+    /** \brief . */
     bool same( const placeholder &other ) const
       {
         if( type() != other.type() ) {
           return false;
         }
         // type() == other.type()
-        const ValueType
-          &other_held = dynamic_cast<const holder<ValueType>&>(other).held;
-        return held == other_held;
+        return same_value(other);
+      }
+    /** \brief . */
+    bool same_value( const placeholder &other ) const
+      {
+        return held == static_cast<const holder<ValueType>&>(other).held;
       }
     /** \brief . */
     void print(std::ostream & os) const
@@ -182,6 +297,28 @@ public:
     ValueType held;
   };
 
+  /** \brief Inline storage for small values. */
+  union storage_t {
+    void *p;
+    double d;
+    long long ll;
+    char bytes[4*sizeof(void*)];
+  };
+
+  /** \brief True if the value is stored inline rather than on the heap. */
+  template<typename ValueType>
+  struct is_stored_inline {
+#ifdef HAVE_TEUCHOS_CXX11
+    static const bool value =
+      sizeof(holder<ValueType>) <= sizeof(storage_t)
+      && alignof(holder<ValueType>) <= alignof(storage_t)
+      && std::is_nothrow_move_constructible<ValueType>::value;
+#else
+    // Without move semantics moving an inline value would mean copying it
+    static const bool value = false;
+#endif
+  };
+
   //@}
 
 public:
@@ -190,6 +327,17 @@ public:
     { return content; }
   const placeholder* access_content() const
     { return content; }
+  // Precondition: this->holds<ValueType>()
+  template<typename ValueType>
+  ValueType& access_held()
+    { return static_cast<holder<ValueType>*>(content)->held; }
+  // Unique per type and shared library, see holds()
+  template<typename ValueType>
+  static const void* type_tag()
+    {
+      static const char tag_obj = 0;
+      return &tag_obj;
+    }
 #endif
 
 private:
@@ -197,7 +345,67 @@ private:
   // /////////////////////////
   // Private data members
   
-  placeholder * content;
+  placeholder * content; // Points to storage or to the heap
+  const void * tag; // type_tag() of the held value, 0 if empty
+  storage_t storage;
+
+  // /////////////////////////
+  // Private member functions
+
+  bool is_inline() const
+    { return content == reinterpret_cast<const placeholder*>(&storage); }
+
+#ifdef HAVE_TEUCHOS_CXX11
+  template<typename ValueType, typename Arg>
+  void create(Arg && value)
+    {
+      create<ValueType>(std::forward<Arg>(value),
+        std::integral_constant<bool, is_stored_inline<ValueType>::value>());
+    }
+
+  template<typename ValueType, typename Arg>
+  void create(Arg && value, std::true_type /*inline*/)
+    {
+      content = new (&storage) holder<ValueType>(std::forward<Arg>(value));
+    }
+
+  template<typename ValueType, typename Arg>
+  void create(Arg && value, std::false_type /*inline*/)
+    {
+      content = new holder<ValueType>(std::forward<Arg>(value));
+    }
+#else
+  template<typename ValueType>
+  void create(const ValueType & value)
+    {
+      content = new holder<ValueType>(value);
+    }
+#endif
+
+  // Preconditions: this->empty()
+  void move_from(any & other)
+    {
+      tag = other.tag;
+      if (other.is_inline()) {
+        content = other.content->move_into(&storage);
+        other.destroy();
+      }
+      else {
+        content = other.content;
+        other.content = 0;
+        other.tag = 0;
+      }
+    }
+
+  void destroy()
+    {
+      if (is_inline())
+        content->~placeholder();
+      else
+        delete content;
+      content = 0;
+      tag = 0;
+    }
 
 };
 
@@ -210,39 +418,30 @@ public:
   bad_any_cast( const std::string msg ) : std::runtime_error(msg) {}
 };
 
+// Throw <tt>bad_any_cast</tt> for below function (never returns and is kept
+// out of the way of the type check)
+TEUCHOS_NORETURN TEUCHOS_COLD TEUCHOS_LIB_DLL_EXPORT
+void any_cast_throw_exception(
+  const std::string &ValueTypeName, const any &operand
+  );
+
 /*! \relates any
     \brief Used to extract the templated value held in Teuchos::any to a given value type.
 
     \note <ul>   <li> If the templated value type and templated type are not the same then a 
     bad_any_cast is thrown.
-    <li> If the dynamic cast fails, then a Teuchos::bad_any_cast std::exception is thrown.
+    <li> If <tt>operand</tt> is empty, then a Teuchos::bad_any_cast std::exception is thrown.
     </ul>
+
+    The type check is normally a single pointer comparison (see
+    <tt>any::holds()</tt>) and the error message is only built on failure.
 */
 template<typename ValueType>
 ValueType& any_cast(any &operand)
 {
-  const std::string ValueTypeName = TypeNameTraits<ValueType>::name();
-  TEST_FOR_EXCEPTION(
-    operand.type() != typeid(ValueType), bad_any_cast
-    ,"any_cast<"<<ValueTypeName<<">(operand): Error, cast to type "
-    << "any::holder<"<<ValueTypeName<<"> failed since the actual underlying type is \'"
-    << typeName(*operand.access_content()) << "!"
-    );
-  TEST_FOR_EXCEPTION(
-    !operand.access_content(), bad_any_cast
-    ,"any_cast<"<<ValueTypeName<<">(operand): Error, cast to type "
-    << "any::holder<"<<ValueTypeName<<"> failed because the content is NULL"
-    );
-  any::holder<ValueType>
-    *dyn_cast_content = dynamic_cast<any::holder<ValueType>*>(operand.access_content());
-  TEST_FOR_EXCEPTION(
-    !dyn_cast_content, std::logic_error
-    ,"any_cast<"<<ValueTypeName <<">(operand): Error, cast to type "
-    << "any::holder<"<<ValueTypeName<<"> failed but should not have and the actual underlying type is \'"
-    << typeName(*operand.access_content()) << "!"
-    << "  The problem might be related to incompatible RTTI systems in static and shared libraries!"
-    );
-  return dyn_cast_content->held;
+  if (!operand.holds<ValueType>())
+    any_cast_throw_exception(TypeNameTraits<ValueType>::name(), operand);
+  return operand.access_held<ValueType>();
 }
 
 /*! \relates any
@@ -251,7 +450,7 @@ ValueType& any_cast(any &operand)
 
     \note <ul>   <li> If the templated value type and templated type are not the same then a 
     bad_any_cast is thrown.
-    <li> If the dynamic cast fails, then a logic_error is thrown.
+    <li> If <tt>operand</tt> is empty, then a Teuchos::bad_any_cast std::exception is thrown.
     </ul>
 */
 template<typename ValueType>
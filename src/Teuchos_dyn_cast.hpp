@@ -31,6 +31,13 @@
 
 
 #include "Teuchos_TypeNameTraits.hpp"
+#include <typeinfo>
+#ifdef HAVE_TEUCHOS_CXX11
+#  include <atomic>
+#  include <cstddef>
+#  include <type_traits>
+#  include <utility>
+#endif
 
 
 namespace Teuchos {
@@ -61,6 +68,220 @@ TEUCHOS_LIB_DLL_EXPORT void dyn_cast_throw_exception(
   );
 
 
+#ifdef HAVE_TEUCHOS_CXX11
+
+
+namespace DynCastPrivateUtilityPack {
+
+
+// True if static_cast<T_To*>(T_From*) compiles and is a downcast, i.e. T_To
+// is T_From or derived from it through non-virtual and unambiguous bases.
+// The static_cast to void* also compiles but is not what dynamic_cast<void*>
+// returns (the most derived object).
+template<class T_To, class T_From, class = void>
+struct CanStaticCast : std::false_type {};
+
+template<class T_To, class T_From>
+struct CanStaticCast<T_To, T_From,
+  decltype(void(static_cast<T_To*>(std::declval<T_From*>())))>
+  : std::integral_constant<bool, !std::is_void<T_To>::value> {};
+
+
+// True if T_To can not be derived from, so an object can only be a T_To if
+// its dynamic type is exactly T_To.
+template<class T>
+struct IsFinal
+#if __cplusplus >= 201402L
+  : std::integral_constant<bool, std::is_final<T>::value> {};
+#else
+  : std::false_type {};
+#endif
+
+
+// Remembers whether dynamic_cast<T_To*>(T_From*) succeeds for the dynamic
+// types seen.
+//
+// This is only used when T_To is derived from T_From through non-virtual
+// bases, so a cast that succeeds is a static_cast.  Through a virtual base
+// the offsets of the subobjects depend on the most derived object (and
+// differ while a base is being constructed), so those casts are not cached.
+// The result depends on the dynamic type of the object and on which T_From
+// subobject is passed in (with multiple inheritance one object can hold
+// several), which is identified by its offset in the most derived object.
+// The results are kept in a small table of slots indexed by a hash of the
+// dynamic type and the offset, so a lookup checks one slot.  A miss
+// overwrites its slot in place, so a call site that sees more types than
+// there are slots never allocates.  Each slot is guarded by a sequence
+// number and a reader that races with a writer just misses.  This is done in
+// every build, not just with HAVE_TEUCHOS_THREAD_SAFE, since the table is
+// shared by all threads casting between the same types.
+template<class T_To, class T_From>
+class DynCastCache {
+public:
+  static T_To* cast(T_From *from, const std::type_info &type)
+    {
+      const std::ptrdiff_t from_offset = reinterpret_cast<const char*>(from)
+        - reinterpret_cast<const char*>(dynamic_cast<const void*>(from));
+      Slot &slot = slots_[slot_index(type, from_offset)];
+      bool succeeds = false;
+      if (slot.lookup(type, from_offset, succeeds))
+        return succeeds ? static_cast<T_To*>(from) : 0;
+      T_To *to = dynamic_cast<T_To*>(from);
+      // A cast that succeeds as a cross cast (T_From ambiguous in the object)
+      // is not a static_cast and is not remembered.  Checked with the upcast
+      // since the downcast of from is undefined if it is not a T_To.
+      if (!to || static_cast<const volatile T_From*>(to) == from)
+        slot.store(type, from_offset, to != 0);
+      return to;
+    }
+private:
+  enum { numSlots = 16 };
+  struct Slot {
+    std::atomic<unsigned> seq; // Odd while the slot is being written
+    std::atomic<const std::type_info*> type;
+    std::atomic<std::ptrdiff_t> from_offset;
+    std::atomic<bool> succeeds;
+    bool lookup(const std::type_info &_type, std::ptrdiff_t _from_offset,
+      bool &_succeeds) const
+      {
+        const unsigned s = seq.load(std::memory_order_acquire);
+        if (s & 1)
+          return false;
+        const bool match = type.load(std::memory_order_relaxed) == &_type
+          && from_offset.load(std::memory_order_relaxed) == _from_offset;
+        _succeeds = succeeds.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return match && seq.load(std::memory_order_relaxed) == s;
+      }
+    void store(const std::type_info &_type, std::ptrdiff_t _from_offset,
+      bool _succeeds)
+      {
+        unsigned s = seq.load(std::memory_order_relaxed);
+        if ((s & 1) || !seq.compare_exchange_strong(s, s+1,
+            std::memory_order_relaxed))
+          return; // Another thread is writing this slot
+        std::atomic_thread_fence(std::memory_order_release);
+        type.store(&_type, std::memory_order_relaxed);
+        from_offset.store(_from_offset, std::memory_order_relaxed);
+        succeeds.store(_succeeds, std::memory_order_relaxed);
+        seq.store(s+2, std::memory_order_release);
+      }
+  };
+  static int slot_index(const std::type_info &type, std::ptrdiff_t from_offset)
+    {
+      // Multiplicative hashing, the type_info objects are often just a few
+      // words apart
+      const std::size_t key =
+        reinterpret_cast<std::size_t>(&type) + from_offset;
+      return static_cast<int>(((key * 2654435761u) >> 16) % numSlots);
+    }
+  static Slot slots_[numSlots]; // Zero initialized, so all empty
+};
+
+
+template<class T_To, class T_From>
+typename DynCastCache<T_To,T_From>::Slot
+DynCastCache<T_To,T_From>::slots_[DynCastCache<T_To,T_From>::numSlots];
+
+
+// Conversion to a base class (but not to void), no runtime check needed
+template<class T_To, class T_From>
+inline
+T_To* dyn_cast_ptr(T_From *from, std::true_type)
+{
+  return from;
+}
+
+
+template<class T_To, class T_From>
+inline
+T_To* exact_cast(T_From *from, const std::type_info &, std::true_type)
+{
+  return static_cast<T_To*>(from);
+}
+
+
+// T_To is reached through a virtual base (or T_From is ambiguous in it) so
+// the offset depends on the object
+template<class T_To, class T_From>
+inline
+T_To* exact_cast(T_From *from, const std::type_info &, std::false_type)
+{
+  return dynamic_cast<T_To*>(from);
+}
+
+
+template<class T_To, class T_From>
+inline
+T_To* cached_cast(T_From *from, const std::type_info &type, std::true_type)
+{
+  return DynCastCache<T_To,T_From>::cast(from, type);
+}
+
+
+// A cast from a virtual base or a cross cast, nothing is cached (see
+// DynCastCache)
+template<class T_To, class T_From>
+inline
+T_To* cached_cast(T_From *from, const std::type_info &, std::false_type)
+{
+  return dynamic_cast<T_To*>(from);
+}
+
+
+template<class T_To, class T_From>
+inline
+T_To* dyn_cast_ptr(T_From *from, std::false_type)
+{
+  const std::type_info &type = typeid(*from);
+  // Comparing the addresses is enough for the common case, other shared
+  // libraries are handled by the cache.
+  if (&type == &typeid(T_To))
+    return exact_cast<T_To>(from, type, CanStaticCast<T_To,T_From>());
+  if (IsFinal<T_To>::value && type != typeid(T_To))
+    return 0;
+  return cached_cast<T_To>(from, type, CanStaticCast<T_To,T_From>());
+}
+
+
+} // namespace DynCastPrivateUtilityPack
+
+
+#endif // HAVE_TEUCHOS_CXX11
+
+
+/** \brief Fast replacement for <tt>dynamic_cast<T_To*>(from)</tt>.
+ *
+ * \ingroup teuchos_language_support_grp
+ *
+ * Returns the same result as <tt>dynamic_cast<T_To*>(from)</tt> (including
+ * <tt>NULL</tt> if the cast fails) but avoids searching the class hierarchy
+ * in the common cases.  A cast to a base class needs no runtime check at
+ * all.  If the dynamic type of <tt>*from</tt> is exactly <tt>T_To</tt> then
+ * a <tt>static_cast</tt> is used.  Otherwise, for a downcast through
+ * non-virtual bases, whether the <tt>dynamic_cast</tt> succeeds is
+ * remembered in a small table per pair of types so that it is usually only
+ * computed once per dynamic type.  Casts from virtual bases, cross casts and
+ * casts to <tt>void</tt> (which return the most derived object) always use
+ * <tt>dynamic_cast</tt>.  This is all correct with virtual and multiple
+ * inheritance.  Without C++11 this is just <tt>dynamic_cast</tt>.
+ */
+template <class T_To, class T_From>
+inline
+T_To* dyn_cast_ptr(T_From *from)
+{
+#ifdef HAVE_TEUCHOS_CXX11
+  if (!from)
+    return 0;
+  return DynCastPrivateUtilityPack::dyn_cast_ptr<T_To>(from,
+    std::integral_constant<bool, std::is_convertible<T_From*,T_To*>::value
+      && !std::is_void<T_To>::value>());
+#else
+  return dynamic_cast<T_To*>(from);
+#endif
+}
+
+
 /** \brief Dynamic casting utility function meant to replace
  * <tt>dynamic_cast<T&></tt> by throwing a better documented error
  * message.
@@ -153,13 +374,14 @@ TEUCHOS_LIB_DLL_EXPORT void dyn_cast_throw_exception(
  *
  * Note that this function is inlined and does not incur any
  * significant runtime performance penalty over the raw
- * <tt>dynamic_cast<T&>()</tt> operator.
+ * <tt>dynamic_cast<T&>()</tt> operator.  It is usually faster since the
+ * cast is done with <tt>dyn_cast_ptr()</tt>.
  */
 template <class T_To, class T_From>
 inline
 T_To& dyn_cast(T_From &from)
 {
-  T_To *to_ = dynamic_cast<T_To*>(&from);
+  T_To *to_ = dyn_cast_ptr<T_To>(&from);
   if(!to_)
     dyn_cast_throw_exception(
       TypeNameTraits<T_From>::name(),
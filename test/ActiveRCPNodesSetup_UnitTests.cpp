@@ -0,0 +1,29 @@
+#include "Teuchos_RCP.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <vector>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+
+namespace {
+
+
+// Constructed before the first RCP of the program and only filled in main(),
+// so it is destroyed after the setup object created by that RCP.  Its nodes
+// must still be gone before the active nodes are printed at exit (the test
+// fails if they are, see CMakeLists.txt).
+std::vector<RCP<int> > staticRCPs;
+
+
+} // namespace
+
+
+int main()
+{
+  staticRCPs.push_back(rcp(new int(1)));
+  staticRCPs.push_back(rcp(new int(2)));
+  TEST_EQUALITY(Teuchos::RCPNodeTracer::numActiveRCPNodes(), 2);
+  return unitTestResult();
+}
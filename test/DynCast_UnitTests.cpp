@@ -0,0 +1,147 @@
+#include "Teuchos_dyn_cast.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <typeinfo>
+#include <vector>
+
+using Teuchos::dyn_cast;
+using Teuchos::dyn_cast_ptr;
+
+
+namespace {
+
+
+struct Base { virtual ~Base() {} };
+
+struct Mid : Base {};
+
+template<int N> struct Leaf : Mid { int n[N]; };
+
+template<int N> struct Other : Base { int n[N]; };
+
+
+// More dynamic types than the cache has slots, half of them failing
+void many_types()
+{
+  Leaf<1> l1; Leaf<2> l2; Leaf<3> l3; Leaf<4> l4; Leaf<5> l5; Leaf<6> l6;
+  Leaf<7> l7; Leaf<8> l8; Leaf<9> l9; Leaf<10> l10;
+  Other<1> o1; Other<2> o2; Other<3> o3; Other<4> o4; Other<5> o5;
+  Other<6> o6; Other<7> o7; Other<8> o8; Other<9> o9; Other<10> o10;
+  Base *objs[] = { &l1, &o1, &l2, &o2, &l3, &o3, &l4, &o4, &l5, &o5, &l6,
+    &o6, &l7, &o7, &l8, &o8, &l9, &o9, &l10, &o10 };
+  const int numObjs = sizeof(objs)/sizeof(objs[0]);
+  for (int k = 0; k < 100; ++k) {
+    for (int i = 0; i < numObjs; ++i) {
+      Mid *mid = dyn_cast_ptr<Mid>(objs[i]);
+      if (mid != dynamic_cast<Mid*>(objs[i]))
+        TEST_ASSERT(mid == dynamic_cast<Mid*>(objs[i]));
+    }
+  }
+}
+
+
+// Two Base subobjects in one object.  A cast from one of them to the other
+// side is a cross cast that is not a static_cast.
+struct Left : Base {};
+struct Right : Base {};
+struct Both : Left, Right {};
+struct LeftOnly : Left {};
+
+void several_subobjects()
+{
+  Both both;
+  LeftOnly leftOnly;
+  Base *viaLeft = static_cast<Left*>(&both);
+  Base *viaRight = static_cast<Right*>(&both);
+  for (int k = 0; k < 3; ++k) {
+    TEST_ASSERT(dyn_cast_ptr<Left>(viaLeft) == static_cast<Left*>(&both));
+    TEST_ASSERT(dyn_cast_ptr<Right>(viaLeft) == dynamic_cast<Right*>(viaLeft));
+    TEST_ASSERT(dyn_cast_ptr<Right>(viaRight) == static_cast<Right*>(&both));
+    TEST_ASSERT(dyn_cast_ptr<Left>(viaRight) == dynamic_cast<Left*>(viaRight));
+    TEST_ASSERT(dyn_cast_ptr<Right>(static_cast<Base*>(&leftOnly)) == 0);
+  }
+}
+
+
+// A cast to void gives the most derived object, not the subobject
+void void_target()
+{
+  Both both;
+  Base *viaRight = static_cast<Right*>(&both);
+  const Base *cviaRight = viaRight;
+  for (int k = 0; k < 3; ++k) {
+    TEST_ASSERT(dyn_cast_ptr<void>(viaRight) == &both);
+    TEST_ASSERT(dyn_cast_ptr<const void>(cviaRight) == &both);
+    TEST_ASSERT(dyn_cast_ptr<void>(static_cast<Right*>(&both)) == &both);
+  }
+}
+
+
+// The offset of a virtual base depends on the most derived type
+struct VBase { virtual ~VBase() {} };
+struct VMid : virtual VBase { int m; };
+struct Pad { virtual ~Pad() {} int pad[7]; };
+struct VLeft : VMid {};
+struct VRight : Pad, VMid {};
+
+void virtual_bases()
+{
+  VLeft left;
+  VRight right;
+  VMid mid;
+  VBase *objs[] = { &left, &right, &mid };
+  VMid *mids[] = { &left, &right, &mid };
+  for (int k = 0; k < 3; ++k) {
+    for (int i = 0; i < 3; ++i) {
+      TEST_ASSERT(dyn_cast_ptr<VMid>(objs[i]) == mids[i]);
+      TEST_ASSERT(dyn_cast_ptr<const VMid>(
+          static_cast<const VBase*>(objs[i])) == mids[i]);
+    }
+    TEST_ASSERT(dyn_cast_ptr<Pad>(mids[1]) == static_cast<Pad*>(&right));
+    TEST_ASSERT(dyn_cast_ptr<Pad>(mids[0]) == 0);
+  }
+}
+
+
+// While a base is constructed its dynamic type is the base
+VMid *midSeenInCtor = 0;
+struct Probe : virtual VBase {
+  Probe() { midSeenInCtor = dyn_cast_ptr<VMid>(static_cast<VBase*>(this)); }
+};
+struct ProbeMid : Pad, VMid, Probe {};
+
+void during_construction()
+{
+  for (int k = 0; k < 3; ++k) {
+    ProbeMid obj;
+    TEST_ASSERT(midSeenInCtor == 0);
+    TEST_ASSERT(dyn_cast_ptr<VMid>(static_cast<VBase*>(&obj))
+      == static_cast<VMid*>(&obj));
+  }
+}
+
+
+void dyn_cast_reference()
+{
+  Leaf<1> leaf;
+  Other<1> other;
+  Base &b1 = leaf, &b2 = other;
+  TEST_ASSERT(&dyn_cast<Mid>(b1) == static_cast<Mid*>(&leaf));
+  TEST_ASSERT(&dyn_cast<Leaf<1> >(b1) == &leaf);
+  TEST_THROW(dyn_cast<Mid>(b2), std::bad_cast);
+}
+
+
+} // namespace
+
+
+int main()
+{
+  many_types();
+  several_subobjects();
+  void_target();
+  virtual_bases();
+  during_construction();
+  dyn_cast_reference();
+  return unitTestResult();
+}
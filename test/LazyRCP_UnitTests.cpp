@@ -0,0 +1,126 @@
+#include "Teuchos_LazyRCP.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <stdexcept>
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+#  include <thread>
+#  include <vector>
+#endif
+
+using Teuchos::RCP;
+using Teuchos::LazyRCP;
+using Teuchos::rcp;
+using Teuchos::null;
+
+
+namespace {
+
+
+struct Base {
+  virtual ~Base() {}
+  virtual int value() const { return 1; }
+};
+
+struct Derived : Base {
+  int value() const { return 2; }
+};
+
+
+void created_on_first_use()
+{
+  int numCalls = 0;
+  LazyRCP<Base> lazy([&]() { ++numCalls; return rcp(new Base); });
+  TEST_ASSERT(!lazy.is_initialized());
+  TEST_EQUALITY(numCalls, 0);
+  TEST_EQUALITY(lazy->value(), 1);
+  TEST_ASSERT(lazy.is_initialized());
+  const RCP<Base> obj = lazy.getRCP();
+  TEST_EQUALITY(obj.get(), lazy.get());
+  TEST_EQUALITY((*lazy).value(), 1);
+  TEST_EQUALITY(numCalls, 1);
+  TEST_EQUALITY(obj.strong_count(), 2);
+}
+
+
+void null_and_given_objects()
+{
+  LazyRCP<Base> lazyNull;
+  TEST_ASSERT(lazyNull.is_initialized());
+  TEST_ASSERT(lazyNull.is_null());
+  LazyRCP<Base> lazyFactoryNull([]() { return RCP<Base>(); });
+  TEST_ASSERT(lazyFactoryNull.is_null());
+  const RCP<Base> obj = rcp(new Derived);
+  LazyRCP<Base> lazyObj(obj);
+  TEST_ASSERT(lazyObj.is_initialized());
+  TEST_EQUALITY(lazyObj.get(), obj.get());
+  LazyRCP<Base> lazyDefault(Teuchos::lazyRCPDefaultFactory<Base, Derived>());
+  TEST_EQUALITY(lazyDefault->value(), 2);
+}
+
+
+void factory_throws_and_is_retried()
+{
+  int numCalls = 0;
+  LazyRCP<Base> lazy([&]() -> RCP<Base> {
+      if (++numCalls == 1)
+        throw std::runtime_error("first call fails");
+      return rcp(new Base);
+    });
+  TEST_THROW(lazy.getRCP(), std::runtime_error);
+  TEST_ASSERT(!lazy.is_initialized());
+  TEST_ASSERT(!lazy.is_null());
+  TEST_EQUALITY(numCalls, 2);
+}
+
+
+void factory_released_after_call()
+{
+  RCP<Base> held = rcp(new Base);
+  LazyRCP<Base> lazy([held]() { return held; });
+  TEST_EQUALITY(held.strong_count(), 2);
+  lazy.getRCP();
+  // The factory (and its copy of held) is gone, the object is held once
+  TEST_EQUALITY(held.strong_count(), 2);
+  LazyRCP<Base> lazy2([held]() { return rcp(new Derived); });
+  TEST_EQUALITY(held.strong_count(), 3);
+  lazy2.getRCP();
+  TEST_EQUALITY(held.strong_count(), 2);
+}
+
+
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+void one_call_from_many_threads()
+{
+  std::atomic<int> numCalls(0);
+  LazyRCP<Base> lazy([&]() {
+      ++numCalls;
+      std::this_thread::yield();
+      return rcp(new Base);
+    });
+  std::vector<Base*> seen(4, 0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+    threads.push_back(std::thread([&, t]() { seen[t] = lazy.get(); }));
+  for (int t = 0; t < 4; ++t)
+    threads[t].join();
+  TEST_EQUALITY(numCalls.load(), 1);
+  for (int t = 1; t < 4; ++t)
+    TEST_EQUALITY(seen[t], seen[0]);
+}
+#endif
+
+
+} // namespace
+
+
+int main()
+{
+  created_on_first_use();
+  null_and_given_objects();
+  factory_throws_and_is_retried();
+  factory_released_after_call();
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  one_call_from_many_threads();
+#endif
+  return unitTestResult();
+}
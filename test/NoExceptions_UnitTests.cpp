@@ -0,0 +1,90 @@
+// Built with -fno-exceptions against the library sources built the same way
+// (see CMakeLists.txt).  Every error then goes to the error handler.
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_dyn_cast.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <stdexcept>
+#include <string>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+using Teuchos::dyn_cast;
+
+
+namespace {
+
+
+const char *expectedName = "";
+const char *expectedMsgPart = "";
+
+// Returns (so the program is aborted) only if it got the expected error,
+// otherwise the child process exits normally and the test fails
+void checkingHandler( const char *exceptionName, const std::string &msg )
+{
+  if (std::string(exceptionName) != expectedName
+    || msg.find(expectedMsgPart) == std::string::npos)
+  {
+    std::_Exit(0);
+  }
+}
+
+
+void expectError( const char *exceptionName, const char *msgPart )
+{
+  TestForException_setErrorHandler(&checkingHandler);
+  expectedName = exceptionName;
+  expectedMsgPart = msgPart;
+}
+
+
+struct Base { virtual ~Base() {} };
+struct Derived : Base {};
+
+
+void test_for_exception_aborts()
+{
+  TEST_ABORTS([]() {
+      expectError("std::out_of_range", "index = 7");
+      TEST_FOR_EXCEPTION(true, std::out_of_range, "index = " << 7);
+    });
+  TEST_ASSERT(!unitTestAborts([]() {
+      expectError("std::logic_error", "index = 7");
+      TEST_FOR_EXCEPTION(true, std::out_of_range, "index = " << 7);
+    }));
+}
+
+
+void null_dereference_aborts()
+{
+#ifdef TEUCHOS_DEBUG
+  TEST_ABORTS([]() {
+      expectError("NullReferenceError", "operator->()");
+      RCP<int> p;
+      *p = 1;
+    });
+#endif
+}
+
+
+void failed_dyn_cast_aborts()
+{
+  TEST_ABORTS([]() {
+      expectError("m_bad_cast", "Derived");
+      Base base;
+      dyn_cast<Derived>(base);
+    });
+}
+
+
+} // namespace
+
+
+int main()
+{
+  test_for_exception_aborts();
+  null_dereference_aborts();
+  failed_dyn_cast_aborts();
+  return unitTestResult();
+}
@@ -0,0 +1,142 @@
+#include "Teuchos_RCPAllocator.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <stdexcept>
+
+using Teuchos::RCP;
+using Teuchos::rcpWithAllocator;
+using Teuchos::null;
+
+
+namespace {
+
+
+struct AllocStats {
+  AllocStats() : numAllocs(0), numLiveAllocs(0) {}
+  int numAllocs;
+  int numLiveAllocs;
+};
+
+
+template<class T>
+struct CountingAllocator {
+  typedef T value_type;
+  explicit CountingAllocator(AllocStats &stats_in) : stats(&stats_in) {}
+  template<class U>
+  CountingAllocator(const CountingAllocator<U> &a) : stats(a.stats) {}
+  T* allocate(std::size_t n)
+    {
+      ++stats->numAllocs;
+      ++stats->numLiveAllocs;
+      return std::allocator<T>().allocate(n);
+    }
+  void deallocate(T* p, std::size_t n)
+    {
+      --stats->numLiveAllocs;
+      std::allocator<T>().deallocate(p, n);
+    }
+  AllocStats *stats;
+};
+
+template<class T, class U>
+bool operator==(const CountingAllocator<T> &a, const CountingAllocator<U> &b)
+{ return a.stats == b.stats; }
+
+template<class T, class U>
+bool operator!=(const CountingAllocator<T> &a, const CountingAllocator<U> &b)
+{ return a.stats != b.stats; }
+
+
+int numLiveObjs = 0;
+
+struct A {
+  A(int v1, int v2) : value(v1 + v2) { ++numLiveObjs; }
+  ~A() { --numLiveObjs; }
+  int value;
+};
+
+struct Throws {
+  Throws() { throw std::runtime_error("Throws"); }
+};
+
+
+void object_and_node_from_allocator()
+{
+  AllocStats stats;
+  RCP<A> a = rcpWithAllocator<A>(CountingAllocator<char>(stats), 2, 3);
+  TEST_EQUALITY(a->value, 5);
+  TEST_EQUALITY(stats.numAllocs, 2);
+  TEST_EQUALITY(stats.numLiveAllocs, 2);
+  RCP<A> w = a.create_weak();
+  a = null;
+  // The object is gone but the node stays until the last weak reference
+  TEST_EQUALITY(numLiveObjs, 0);
+  TEST_EQUALITY(stats.numLiveAllocs, 1);
+  w = null;
+  TEST_EQUALITY(stats.numLiveAllocs, 0);
+}
+
+
+void throwing_constructor_frees_memory()
+{
+  AllocStats stats;
+  TEST_THROW(rcpWithAllocator<Throws>(CountingAllocator<int>(stats)),
+    std::runtime_error);
+  TEST_EQUALITY(stats.numAllocs, 1);
+  TEST_EQUALITY(stats.numLiveAllocs, 0);
+}
+
+
+#ifdef HAVE_TEUCHOS_PMR
+
+class CountingResource : public std::pmr::memory_resource {
+public:
+  CountingResource() : numLiveAllocs(0) {}
+  int numLiveAllocs;
+private:
+  void* do_allocate(std::size_t bytes, std::size_t align)
+    {
+      ++numLiveAllocs;
+      return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+  void do_deallocate(void* p, std::size_t bytes, std::size_t align)
+    {
+      --numLiveAllocs;
+      std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+    }
+  bool do_is_equal(const std::pmr::memory_resource &other) const noexcept
+    { return this == &other; }
+};
+
+struct Request {
+  typedef std::pmr::polymorphic_allocator<char> allocator_type;
+  Request(int n, const allocator_type &alloc) : values(n, 0, alloc) {}
+  std::pmr::vector<int> values;
+};
+
+void members_from_memory_resource()
+{
+  CountingResource mr;
+  RCP<Request> req = Teuchos::rcpWithMemoryResource<Request>(&mr, 100);
+  TEST_EQUALITY(req->values.size(), 100u);
+  TEST_ASSERT(req->values.get_allocator().resource() == &mr);
+  TEST_EQUALITY(mr.numLiveAllocs, 3); // Object, node and vector
+  req = null;
+  TEST_EQUALITY(mr.numLiveAllocs, 0);
+}
+
+#endif // HAVE_TEUCHOS_PMR
+
+
+} // namespace
+
+
+int main()
+{
+  object_and_node_from_allocator();
+  throwing_constructor_frees_memory();
+#ifdef HAVE_TEUCHOS_PMR
+  members_from_memory_resource();
+#endif
+  return unitTestResult();
+}
@@ -0,0 +1,137 @@
+#include "Teuchos_RCPBulk.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <new>
+#include <stdexcept>
+
+using Teuchos::RCP;
+using Teuchos::rcpBulk;
+using Teuchos::rcpBulkShared;
+using Teuchos::null;
+
+
+// Counts the live heap allocations to check when blocks are freed
+namespace { long numLiveAllocs = 0; }
+
+void* operator new(std::size_t size)
+{
+  void *p = std::malloc(size ? size : 1);
+  if (!p)
+    throw std::bad_alloc();
+  ++numLiveAllocs;
+  return p;
+}
+
+void operator delete(void *p) noexcept
+{
+  if (p) {
+    --numLiveAllocs;
+    std::free(p);
+  }
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+  operator delete(p);
+}
+
+
+namespace {
+
+
+int numLiveObjs = 0;
+int numToConstruct = -1;
+
+struct Point {
+  Point(double x_in, double y_in) : x(x_in), y(y_in)
+    {
+      if (numToConstruct == 0)
+        throw std::runtime_error("Point");
+      --numToConstruct;
+      ++numLiveObjs;
+    }
+  ~Point() { --numLiveObjs; }
+  double x, y;
+};
+
+
+void independent_lifetimes()
+{
+  std::vector<RCP<Point> > points = rcpBulk<Point>(10, 4, 1.0, 2.0);
+  TEST_EQUALITY(points.size(), 10u);
+  TEST_EQUALITY(numLiveObjs, 10);
+  // Objects of one block are next to each other
+  TEST_EQUALITY(points[1].get(), points[0].get() + 1);
+  TEST_EQUALITY(points[3].get(), points[0].get() + 3);
+  TEST_EQUALITY(points[5].get(), points[4].get() + 1);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    TEST_EQUALITY(points[i].strong_count(), 1);
+    TEST_EQUALITY(points[i]->y, 2.0);
+  }
+  TEST_ASSERT(!points[0].shares_resource(points[1]));
+  points[0] = null;
+  TEST_EQUALITY(numLiveObjs, 9);
+  TEST_EQUALITY(points[1]->x, 1.0);
+}
+
+
+void block_freed_after_last_node()
+{
+  const long numAllocs = numLiveAllocs;
+  std::vector<RCP<Point> > points = rcpBulk<Point>(8, 4, 0.0, 0.0);
+  RCP<Point> w = points[7].create_weak();
+  for (std::size_t i = 0; i < points.size(); ++i)
+    points[i] = null;
+  TEST_EQUALITY(numLiveObjs, 0);
+  // The vector and the second block, which is kept by the weak reference to
+  // its last node
+  TEST_EQUALITY(numLiveAllocs - numAllocs, 2);
+  w = null;
+  TEST_EQUALITY(numLiveAllocs - numAllocs, 1);
+}
+
+
+void throwing_constructor()
+{
+  const long numAllocs = numLiveAllocs;
+  numToConstruct = 6;
+  TEST_THROW(rcpBulk<Point>(8, 4, 0.0, 0.0), std::runtime_error);
+  numToConstruct = 3;
+  TEST_THROW(rcpBulkShared<Point>(8, 0.0, 0.0), std::runtime_error);
+  numToConstruct = -1;
+  TEST_EQUALITY(numLiveObjs, 0);
+  TEST_EQUALITY(numLiveAllocs, numAllocs);
+}
+
+
+void shared_node()
+{
+  TEST_ASSERT(rcpBulkShared<Point>(0, 0.0, 0.0).empty());
+  std::vector<RCP<Point> > points = rcpBulkShared<Point>(5, 3.0, 4.0);
+  TEST_EQUALITY(numLiveObjs, 5);
+  TEST_EQUALITY(points[0].strong_count(), 5);
+  TEST_ASSERT(points[0].shares_resource(points[4]));
+  TEST_EQUALITY(points[4].get(), points[0].get() + 4);
+  RCP<const Point> keep = points[2];
+  RCP<Point> w = points[0].create_weak();
+  points.clear();
+  TEST_EQUALITY(numLiveObjs, 5);
+  TEST_EQUALITY(keep->x, 3.0);
+  keep = null;
+  TEST_EQUALITY(numLiveObjs, 0);
+  TEST_EQUALITY(w.strong_count(), 0);
+}
+
+
+} // namespace
+
+
+int main()
+{
+  independent_lifetimes();
+  block_freed_after_last_node();
+  throwing_constructor();
+  shared_node();
+  TEST_EQUALITY(numLiveObjs, 0);
+  return unitTestResult();
+}
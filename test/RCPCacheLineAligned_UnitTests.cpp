@@ -0,0 +1,132 @@
+#include "Teuchos_RCP.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <new>
+#include <set>
+#include <sstream>
+#include <vector>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+using Teuchos::RCPNode;
+using Teuchos::RCPNodeTracer;
+using Teuchos::ScopedRCPFromRef;
+
+
+namespace {
+
+
+struct Hot { int value; };
+
+
+} // namespace
+
+
+namespace Teuchos {
+TEUCHOS_RCP_NODE_CACHE_LINE_ALIGNED(Hot);
+} // namespace Teuchos
+
+
+namespace {
+
+
+const std::size_t lineSize = TEUCHOS_CACHE_LINE_SIZE;
+
+
+// Add n references to the node of p
+template<class T>
+void makeHot(const RCP<T> &p, int n)
+{
+  for (int i = 0; i < n; ++i) {
+    RCP<T> copy = p;
+  }
+}
+
+
+void aligned_nodes()
+{
+  std::vector<RCP<Hot> > hots;
+  for (int i = 0; i < 8; ++i) {
+    hots.push_back(rcp(new Hot));
+    const std::size_t node = reinterpret_cast<std::size_t>(
+      hots.back().access_private_node().node_ptr());
+    TEST_EQUALITY(node % lineSize, 0u);
+#ifdef TEUCHOS_DEBUG
+    TEST_EQUALITY(hots.back().access_private_node().node_ptr()->get_node_size()
+      % lineSize, 0u);
+#endif
+    makeHot(hots.back(), 200);
+  }
+#ifdef TEUCHOS_DEBUG
+  // Hot but each on its own lines
+  std::ostringstream out;
+  TEST_EQUALITY(RCPNodeTracer::printFalseSharingCandidates(out, 100), 0);
+#endif
+}
+
+
+#ifdef TEUCHOS_DEBUG
+// The nodes of an array of ScopedRCPFromRef objects are only a few bytes
+// apart, so some of them extend into the line holding the count of the next
+// one
+void hot_nodes_sharing_a_line_are_reported()
+{
+  if (!RCPNodeTracer::isTracingActiveRCPNodes())
+    return;
+  typedef ScopedRCPFromRef<int> scope_t;
+  const int numScopes = 32, numHot = 24; // The last few nodes stay cold
+  int objs[numScopes];
+  alignas(TEUCHOS_CACHE_LINE_SIZE) unsigned char buf[numScopes*sizeof(scope_t)];
+  scope_t *scopes = reinterpret_cast<scope_t*>(buf);
+  std::vector<RCPNode*> nodes;
+  for (int i = 0; i < numScopes; ++i) {
+    new (&scopes[i]) scope_t(objs[i]);
+    nodes.push_back(scopes[i].getRCP().access_private_node().node_ptr());
+  }
+  for (int i = 0; i < numHot; ++i)
+    makeHot(scopes[i].getRCP(), 200);
+  // The lines holding the count of a hot node that another hot node occupies
+  std::set<std::size_t> sharedLines;
+  std::set<int> sharingNodes;
+  for (int i = 0; i < numHot; ++i) {
+    const std::size_t countLine =
+      reinterpret_cast<std::size_t>(nodes[i]->count_address()) / lineSize;
+    for (int j = 0; j < numHot; ++j) {
+      const std::size_t begin = reinterpret_cast<std::size_t>(nodes[j]);
+      const std::size_t end = begin + nodes[j]->get_node_size();
+      if (j != i && begin / lineSize <= countLine
+        && countLine <= (end - 1) / lineSize)
+      {
+        sharedLines.insert(countLine);
+        sharingNodes.insert(i);
+        sharingNodes.insert(j);
+      }
+    }
+  }
+  TEST_ASSERT(!sharedLines.empty());
+  std::ostringstream out;
+  const int numLines = RCPNodeTracer::printFalseSharingCandidates(out, 100);
+  TEST_EQUALITY(numLines, static_cast<int>(sharedLines.size()));
+  for (int i = 0; i < numScopes; ++i) {
+    std::ostringstream node;
+    node << "RCPNode address = " << nodes[i] << ",";
+    const bool reported = out.str().find(node.str()) != std::string::npos;
+    TEST_EQUALITY(reported, sharingNodes.count(i) == 1);
+  }
+  for (int i = 0; i < numScopes; ++i)
+    scopes[i].~scope_t();
+}
+#endif
+
+
+} // namespace
+
+
+int main()
+{
+  aligned_nodes();
+#ifdef TEUCHOS_DEBUG
+  hot_nodes_sharing_a_line_are_reported();
+#endif
+  return unitTestResult();
+}
@@ -0,0 +1,116 @@
+#include "Teuchos_RCP.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <string>
+
+using Teuchos::RCP;
+using Teuchos::RCPNodeDestroyCallback;
+using Teuchos::EPrePostDestruction;
+using Teuchos::PRE_DESTROY;
+using Teuchos::POST_DESTROY;
+using Teuchos::rcp;
+using Teuchos::null;
+
+
+namespace {
+
+
+std::string events;
+
+bool objAlive = false;
+
+struct A {
+  A() { objAlive = true; }
+  ~A() { objAlive = false; events += "~A "; }
+};
+
+
+class Recorder : public RCPNodeDestroyCallback {
+public:
+  explicit Recorder(const std::string &name) : name_(name) {}
+  void on_destroy(EPrePostDestruction destroy_when)
+    {
+      TEST_ASSERT(!is_registered());
+      TEST_EQUALITY(objAlive, destroy_when == PRE_DESTROY);
+      events += name_ + " ";
+    }
+private:
+  std::string name_;
+};
+
+
+class SelfDeleting : public RCPNodeDestroyCallback {
+public:
+  void on_destroy(EPrePostDestruction) { events += "self "; delete this; }
+};
+
+
+void called_in_order()
+{
+  events.clear();
+  Recorder pre1("pre1"), pre2("pre2"), post1("post1"), post2("post2");
+  RCP<A> a = rcp(new A);
+  add_destroy_callback(a, pre1, PRE_DESTROY);
+  add_destroy_callback(a, post1, POST_DESTROY);
+  add_destroy_callback(a, pre2, PRE_DESTROY);
+  add_destroy_callback(a, post2);
+  TEST_ASSERT(pre1.is_registered());
+  RCP<A> w = a.create_weak();
+  RCP<A> a2 = a;
+  a = null;
+  TEST_EQUALITY(events, "");
+  a2 = null;
+  TEST_EQUALITY(events, "pre2 pre1 ~A post2 post1 ");
+  TEST_ASSERT(!pre1.is_registered());
+  TEST_ASSERT(!post2.is_registered());
+}
+
+
+void unregister_and_destroy()
+{
+  events.clear();
+  RCP<A> a = rcp(new A);
+  Recorder r1("r1"), r2("r2");
+  add_destroy_callback(a, r1);
+  add_destroy_callback(a, r2);
+  TEST_ASSERT(r1.unregister());
+  TEST_ASSERT(!r1.unregister());
+  {
+    Recorder r3("r3");
+    add_destroy_callback(a, r3);
+  }
+  TEST_THROW(add_destroy_callback(a, r2), std::logic_error);
+  // Callbacks can be registered again after being removed
+  add_destroy_callback(a, r1, PRE_DESTROY);
+  add_destroy_callback(a, *new SelfDeleting, PRE_DESTROY);
+  a = null;
+  TEST_EQUALITY(events, "self r1 ~A r2 ");
+}
+
+
+void non_owning_rcp_calls_callbacks()
+{
+  // A non-owning RCP still calls the callbacks when the last strong
+  // reference goes away; the object itself is not deleted.
+  events.clear();
+  A obj;
+  Recorder r("r");
+  {
+    RCP<A> a = rcp(&obj, false);
+    add_destroy_callback(a, r, PRE_DESTROY);
+  }
+  TEST_EQUALITY(events, "r ");
+  TEST_ASSERT(!r.is_registered());
+}
+
+
+} // namespace
+
+
+int main()
+{
+  called_in_order();
+  unregister_and_destroy();
+  non_owning_rcp_calls_callbacks();
+  return unitTestResult();
+}
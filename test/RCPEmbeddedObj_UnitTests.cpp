@@ -0,0 +1,155 @@
+#include "Teuchos_RCP.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <string>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+using Teuchos::null;
+using Teuchos::rcpWithEmbeddedObj;
+using Teuchos::rcpWithEmbeddedObjPreDestroy;
+using Teuchos::rcpWithEmbeddedObjPostDestroy;
+using Teuchos::rcpWithInvertedObjOwnership;
+using Teuchos::getInvertedObjOwnershipParent;
+using Teuchos::getEmbeddedObj;
+using Teuchos::embeddedObjDeallocDelete;
+using Teuchos::PRE_DESTROY;
+using Teuchos::POST_DESTROY;
+
+
+namespace {
+
+
+int numCopies = 0, numMoves = 0;
+
+// An embedded object that counts its copies and moves
+struct Counted {
+  Counted() : value(0) {}
+  explicit Counted(int _value) : value(_value) {}
+  Counted(const Counted &c) : value(c.value) { ++numCopies; }
+  Counted(Counted &&c) : value(c.value) { ++numMoves; }
+  Counted& operator=(const Counted &c)
+    { value = c.value; ++numCopies; return *this; }
+  Counted& operator=(Counted &&c)
+    { value = c.value; ++numMoves; return *this; }
+  int value;
+};
+
+
+void resetCounts()
+{
+  numCopies = numMoves = 0;
+}
+
+
+void temporary_is_moved()
+{
+  resetCounts();
+  {
+    RCP<int> p = rcpWithEmbeddedObj(new int(0), Counted(1));
+    TEST_EQUALITY(numCopies, 0);
+    TEST_ASSERT(numMoves > 0);
+    TEST_EQUALITY((getEmbeddedObj<int,Counted>(p).value), 1);
+  }
+  resetCounts();
+  {
+    RCP<int> p = rcpWithEmbeddedObjPreDestroy(new int(0), Counted(2));
+    RCP<int> q = rcpWithEmbeddedObjPostDestroy(new int(0), Counted(3));
+    TEST_EQUALITY(numCopies, 0);
+    TEST_EQUALITY((getEmbeddedObj<int,Counted>(p).value), 2);
+    TEST_EQUALITY((getEmbeddedObj<int,Counted>(q).value), 3);
+  }
+  resetCounts();
+  {
+    RCP<int> p = rcp(new int(0),
+      embeddedObjDeallocDelete<int>(Counted(4), POST_DESTROY), true);
+    TEST_EQUALITY(numCopies, 0);
+    TEST_EQUALITY((getEmbeddedObj<int,Counted>(p).value), 4);
+  }
+  // Clearing the embedded object on release does not copy either
+  TEST_EQUALITY(numCopies, 0);
+}
+
+
+void lvalue_is_copied_once()
+{
+  const Counted counted(5);
+  resetCounts();
+  RCP<int> p = rcpWithEmbeddedObj(new int(0), counted);
+  TEST_EQUALITY(numCopies, 1);
+  TEST_EQUALITY((getEmbeddedObj<int,Counted>(p).value), 5);
+  TEST_EQUALITY(counted.value, 5);
+}
+
+
+std::string events;
+
+struct Recorder {
+  explicit Recorder(const std::string &_name) : name(_name) {}
+  ~Recorder() { events += name + " "; }
+  std::string name;
+};
+
+
+void pre_and_post_destroy()
+{
+  events.clear();
+  rcpWithEmbeddedObjPreDestroy(new Recorder("obj"), rcp(new Recorder("pre")));
+  TEST_EQUALITY(events, "pre obj ");
+  events.clear();
+  rcpWithEmbeddedObjPostDestroy(new Recorder("obj"), rcp(new Recorder("post")));
+  TEST_EQUALITY(events, "obj post ");
+}
+
+
+struct Child {
+  ~Child() { events += "~Child "; }
+};
+
+struct Parent {
+  ~Parent()
+    {
+      // The child is still alive while its parent goes away
+      events += "~Parent(child count " + Teuchos::toString(child.strong_count())
+        + ") ";
+    }
+  RCP<Child> child;
+};
+
+
+void inverted_ownership_keeps_parent_alive()
+{
+  events.clear();
+  RCP<Parent> parent = rcp(new Parent);
+  parent->child = rcp(new Child);
+  Parent *rawParent = parent.get();
+  RCP<Child> invertedChild =
+    rcpWithInvertedObjOwnership(parent->child, parent);
+  TEST_EQUALITY(invertedChild.get(), parent->child.get());
+  parent = null;
+  TEST_EQUALITY(events, "");
+  TEST_EQUALITY(getInvertedObjOwnershipParent<Parent>(invertedChild).get(),
+    rawParent);
+  TEST_EQUALITY(rawParent->child.strong_count(), 2);
+  RCP<Child> copy = invertedChild;
+  invertedChild = null;
+  TEST_EQUALITY(events, "");
+  copy = null;
+  // The pair is destroyed with the node, the parent first (while the pair
+  // still holds the child), then the child, the same as before the pair was
+  // moved into the node
+  TEST_EQUALITY(events, "~Parent(child count 2) ~Child ");
+}
+
+
+} // namespace
+
+
+int main()
+{
+  temporary_is_moved();
+  lvalue_is_copied_once();
+  pre_and_post_destroy();
+  inverted_ownership_keeps_parent_alive();
+  return unitTestResult();
+}
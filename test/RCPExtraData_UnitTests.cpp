@@ -0,0 +1,154 @@
+#include "Teuchos_RCP.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <string>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+using Teuchos::inOutArg;
+using Teuchos::toString;
+using Teuchos::set_extra_data;
+using Teuchos::get_extra_data;
+using Teuchos::get_nonconst_extra_data;
+using Teuchos::get_optional_extra_data;
+using Teuchos::ExtraDataKey;
+using Teuchos::PRE_DESTROY;
+using Teuchos::POST_DESTROY;
+
+
+namespace {
+
+
+std::string events;
+
+struct A {
+  ~A() { events += "~A "; }
+};
+
+struct Recorder {
+  explicit Recorder(const std::string &_name) : name(_name) {}
+  ~Recorder() { events += name + " "; }
+  std::string name;
+};
+
+struct KeyA : ExtraDataKey<int> {};
+struct KeyB : ExtraDataKey<std::string> {};
+struct KeyRecorder : ExtraDataKey<RCP<Recorder> > {};
+struct KeyLast : ExtraDataKey<double> {};
+
+
+void reference_survives_more_extra_data()
+{
+  RCP<int> p = rcp(new int(0));
+  set_extra_data(rcp(new double(1.5)), "d", inOutArg(p));
+  RCP<double> &d = get_nonconst_extra_data<RCP<double> >(p, "d");
+  set_extra_data(0, "i0", inOutArg(p));
+  const int &i0 = get_extra_data<int>(p, "i0");
+  for (int k = 1; k < 100; ++k)
+    set_extra_data(k, "i" + toString(k), inOutArg(p));
+  TEST_EQUALITY(*d, 1.5);
+  TEST_EQUALITY(i0, 0);
+  d = rcp(new double(2.5));
+  TEST_EQUALITY(*get_extra_data<RCP<double> >(p, "d"), 2.5);
+  TEST_EQUALITY(get_extra_data<int>(p, "i99"), 99);
+}
+
+
+void lookup_by_type_and_name()
+{
+  RCP<int> p = rcp(new int(0));
+  TEST_ASSERT(get_optional_extra_data<int>(p, "a").get() == 0);
+  set_extra_data(1, "a", inOutArg(p));
+  set_extra_data(2.0, "a", inOutArg(p));
+  set_extra_data(3, "b", inOutArg(p));
+  set_extra_data(std::string("a long name that is not stored inline"),
+    std::string("a long name that is not stored inline"), inOutArg(p));
+  TEST_EQUALITY(get_extra_data<int>(p, "a"), 1);
+  TEST_EQUALITY(get_extra_data<double>(p, "a"), 2.0);
+  TEST_EQUALITY(get_extra_data<int>(p, "b"), 3);
+  TEST_EQUALITY(get_extra_data<std::string>(p,
+      "a long name that is not stored inline"),
+    "a long name that is not stored inline");
+  TEST_ASSERT(get_optional_extra_data<int>(p, "c").get() == 0);
+  TEST_ASSERT(get_optional_extra_data<double>(p, "b").get() == 0);
+#ifdef TEUCHOS_DEBUG
+  TEST_THROW(get_extra_data<int>(p, "c"), std::invalid_argument);
+  TEST_THROW(set_extra_data(4, "a", inOutArg(p), POST_DESTROY, true),
+    std::invalid_argument);
+#endif
+  set_extra_data(4, "a", inOutArg(p), POST_DESTROY, false);
+  TEST_EQUALITY(get_extra_data<int>(p, "a"), 4);
+  TEST_EQUALITY(
+    Teuchos::any_cast<int>(p.access_private_node().get_extra_data(
+        Teuchos::TypeNameTraits<int>::name(), "b")),
+    3);
+  TEST_ASSERT(Teuchos::RCPNodeExtraData::intern_name("a")
+    == Teuchos::RCPNodeExtraData::intern_name(std::string("a")));
+}
+
+
+void destroyed_pre_and_post()
+{
+  events.clear();
+  {
+    RCP<A> a = rcp(new A);
+    set_extra_data(rcp(new Recorder("post")), "post", inOutArg(a));
+    set_extra_data(rcp(new Recorder("pre")), "pre", inOutArg(a), PRE_DESTROY);
+    set_extra_data<KeyRecorder>(rcp(new Recorder("keyPost")), inOutArg(a),
+      POST_DESTROY);
+    set_extra_data<KeyRecorder>(rcp(new Recorder("keyPre")), inOutArg(a),
+      PRE_DESTROY);
+    TEST_EQUALITY(events, "keyPost ");
+    events.clear();
+  }
+  TEST_EQUALITY(events, "pre keyPre ~A post ");
+}
+
+
+void keys_are_per_node()
+{
+  RCP<int> p = rcp(new int(0)), q = rcp(new int(1));
+  TEST_ASSERT(get_optional_extra_data<KeyA>(p).get() == 0);
+  set_extra_data<KeyB>(std::string("b"), inOutArg(p));
+  TEST_ASSERT(get_optional_extra_data<KeyA>(p).get() == 0);
+  set_extra_data<KeyA>(1, inOutArg(p));
+  set_extra_data<KeyA>(2, inOutArg(q));
+  TEST_EQUALITY(get_extra_data<KeyA>(p), 1);
+  TEST_EQUALITY(get_extra_data<KeyA>(q), 2);
+  TEST_EQUALITY(get_extra_data<KeyB>(p), "b");
+  TEST_ASSERT(get_optional_extra_data<KeyB>(q).get() == 0);
+  get_nonconst_extra_data<KeyA>(q) = 3;
+  TEST_EQUALITY(get_extra_data<KeyA>(q), 3);
+  TEST_EQUALITY(get_extra_data<KeyA>(p), 1);
+}
+
+
+// Only the last key slot is set on the node, the ones below it are empty
+void keys_below_the_set_slot_are_empty()
+{
+  using Teuchos::RCPNodeExtraData;
+  TEST_ASSERT(RCPNodeExtraData::key_slot<KeyLast>()
+    > RCPNodeExtraData::key_slot<KeyA>());
+  RCP<int> p = rcp(new int(0));
+  set_extra_data<KeyLast>(0.5, inOutArg(p));
+  TEST_EQUALITY(get_extra_data<KeyLast>(p), 0.5);
+  TEST_ASSERT(get_optional_extra_data<KeyA>(p).get() == 0);
+  TEST_ASSERT(get_optional_extra_data<KeyRecorder>(p).get() == 0);
+  set_extra_data<KeyA>(4, inOutArg(p), PRE_DESTROY);
+  TEST_EQUALITY(get_extra_data<KeyA>(p), 4);
+  TEST_EQUALITY(get_extra_data<KeyLast>(p), 0.5);
+}
+
+
+} // namespace
+
+
+int main()
+{
+  reference_survives_more_extra_data();
+  lookup_by_type_and_name();
+  destroyed_pre_and_post();
+  keys_are_per_node();
+  keys_below_the_set_slot_are_empty();
+  return unitTestResult();
+}
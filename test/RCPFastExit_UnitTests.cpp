@@ -0,0 +1,119 @@
+#include "Teuchos_RCP.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <string>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+
+namespace {
+
+
+// Where the child process reports what ran during exit
+int reportFd = -1;
+
+void report(const char *what)
+{
+  if (write(reportFd, what, std::strlen(what))) {}
+}
+
+
+struct A {
+  ~A() { report("D"); }
+};
+
+RCP<A>& staticA()
+{
+  static RCP<A> s_a = rcp(new A);
+  return s_a;
+}
+
+void finalizer() { report("F"); }
+
+
+// Runs code in a child process that then exits normally and returns what
+// was reported during exit
+template<class Func>
+std::string exitReport(Func code)
+{
+  int fds[2];
+  if (pipe(fds) != 0)
+    return "pipe failed";
+  std::cout.flush();
+  std::cerr.flush();
+  const pid_t pid = fork();
+  if (pid == 0) {
+    close(fds[0]);
+    reportFd = fds[1];
+    if (!std::freopen("/dev/null", "w", stderr)) {}
+    code();
+    std::exit(unitTestFailures() ? 1 : 0);
+  }
+  close(fds[1]);
+  std::string result;
+  char buf[64];
+  ssize_t n = 0;
+  while ((n = read(fds[0], buf, sizeof(buf))) > 0)
+    result.append(buf, n);
+  close(fds[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    result += " (bad exit status)";
+  return result;
+}
+
+
+void normal_exit()
+{
+  TEST_EQUALITY(exitReport([]() { staticA(); }), "D");
+}
+
+
+void fast_exit_leaks_statics()
+{
+  TEST_EQUALITY(exitReport([]() {
+      staticA();
+      Teuchos::addRCPFastExitFinalizer(finalizer);
+      for (int i = 0; i < 3; ++i)
+        Teuchos::setRCPFastExit(true);
+      TEST_ASSERT(Teuchos::getRCPFastExit());
+    }), "F");
+}
+
+
+void turned_off_again()
+{
+  TEST_EQUALITY(exitReport([]() {
+      staticA();
+      Teuchos::addRCPFastExitFinalizer(finalizer);
+      Teuchos::setRCPFastExit(true);
+      Teuchos::setRCPFastExit(false);
+      TEST_ASSERT(!Teuchos::getRCPFastExit());
+    }), "D");
+}
+
+
+void rcpFastExit_skips_teardown()
+{
+  TEST_EQUALITY(exitReport([]() {
+      staticA();
+      Teuchos::addRCPFastExitFinalizer(finalizer);
+      Teuchos::rcpFastExit(0);
+    }), "F");
+}
+
+
+} // namespace
+
+
+int main()
+{
+  TEST_ASSERT(!Teuchos::getRCPFastExit());
+  normal_exit();
+  fast_exit_leaks_statics();
+  turned_off_again();
+  rcpFastExit_skips_teardown();
+  return unitTestResult();
+}
@@ -0,0 +1,119 @@
+#include "Teuchos_RCP.hpp"
+#include "UnitTestHelpers.hpp"
+
+using Teuchos::RCP;
+using Teuchos::rcpFromRef;
+using Teuchos::rcpFromUndefRef;
+using Teuchos::ScopedRCPFromRef;
+using Teuchos::null;
+
+
+namespace {
+
+
+struct A { int a; A() : a(1) {} };
+
+
+void rcpFromRef_nonowning()
+{
+  A a;
+  RCP<A> ra = rcpFromRef(a);
+  TEST_EQUALITY(ra.get(), &a);
+  TEST_EQUALITY(ra.strong_count(), 1);
+  TEST_ASSERT(!ra.has_ownership());
+  RCP<A> ra2 = ra;
+  TEST_EQUALITY(ra.strong_count(), 2);
+  ra = null;
+  ra2 = null;
+  TEST_EQUALITY(a.a, 1); // Not deleted
+}
+
+
+void rcpFromRef_distinct_nodes()
+{
+  A a, b;
+  RCP<A> ra = rcpFromRef(a), rb = rcpFromRef(b);
+  TEST_ASSERT(!ra.shares_resource(rb));
+  TEST_ASSERT(ra != rb);
+}
+
+
+#ifdef HAVE_TEUCHOS_CXX11
+void rcpFromRef_reuses_node_memory()
+{
+  A a, b;
+  const void *node = 0;
+  {
+    RCP<A> ra = rcpFromRef(a);
+    node = ra.access_private_node().node_ptr();
+  }
+  RCP<A> rb = rcpFromUndefRef(b);
+  TEST_EQUALITY(rb.access_private_node().node_ptr(), node);
+}
+#endif
+
+
+void scoped_getRCP()
+{
+  A a;
+  {
+    ScopedRCPFromRef<A> scope(a);
+    RCP<A> ra = scope.getRCP(), ra2 = scope.getRCP();
+    TEST_EQUALITY(ra.get(), &a);
+    TEST_ASSERT(ra.shares_resource(ra2));
+    TEST_EQUALITY(ra.strong_count(), 3); // Including the scope's own
+  }
+  TEST_EQUALITY(a.a, 1);
+}
+
+
+#ifdef TEUCHOS_DEBUG
+void scoped_dangling_aborts()
+{
+  TEST_ABORTS([]() {
+      A a;
+      RCP<A> ra;
+      {
+        ScopedRCPFromRef<A> scope(a);
+        ra = scope.getRCP();
+      }
+    });
+}
+#endif
+
+
+#if defined(TEUCHOS_DEBUG) && !defined(HAVE_TEUCHOS_DEBUG_RCP_NODE_TRACING)
+void scoped_tracing_turned_on_inside()
+{
+  const bool tracing = Teuchos::RCPNodeTracer::isTracingActiveRCPNodes();
+  Teuchos::RCPNodeTracer::setTracingActiveRCPNodes(false);
+  {
+    A a;
+    ScopedRCPFromRef<A> scope(a);
+    Teuchos::RCPNodeTracer::setTracingActiveRCPNodes(true);
+  }
+  Teuchos::RCPNodeTracer::setTracingActiveRCPNodes(tracing);
+  TEST_ASSERT(true); // Did not try to remove a node that was never added
+}
+#endif
+
+
+} // namespace
+
+
+int main()
+{
+  rcpFromRef_nonowning();
+  rcpFromRef_distinct_nodes();
+#ifdef HAVE_TEUCHOS_CXX11
+  rcpFromRef_reuses_node_memory();
+#endif
+  scoped_getRCP();
+#ifdef TEUCHOS_DEBUG
+  scoped_dangling_aborts();
+#endif
+#if defined(TEUCHOS_DEBUG) && !defined(HAVE_TEUCHOS_DEBUG_RCP_NODE_TRACING)
+  scoped_tracing_turned_on_inside();
+#endif
+  return unitTestResult();
+}
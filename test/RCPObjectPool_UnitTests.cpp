@@ -0,0 +1,190 @@
+#include "Teuchos_RCPObjectPool.hpp"
+#include "UnitTestHelpers.hpp"
+
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+#  include <thread>
+#endif
+
+using Teuchos::RCP;
+using Teuchos::RCPObjectPool;
+using Teuchos::RCPObjectPoolStatistics;
+using Teuchos::rcpFromRef;
+using Teuchos::null;
+
+
+namespace {
+
+
+int numLiveObjs = 0;
+
+struct Msg {
+  Msg() : value(0) { ++numLiveObjs; }
+  ~Msg() { --numLiveObjs; }
+  int value;
+};
+
+struct ClearMsg {
+  void operator()(Msg &msg) const { msg.value = 0; }
+};
+
+typedef RCPObjectPool<Msg, ClearMsg> pool_t;
+
+
+void reuse_on_same_thread()
+{
+  pool_t pool(2);
+  TEST_EQUALITY(numLiveObjs, 2);
+  RCP<Msg> m = pool.acquire();
+  Msg *addr = m.get();
+  m->value = 5;
+  TEST_EQUALITY(m.strong_count(), 1);
+  m = null;
+  TEST_EQUALITY(numLiveObjs, 2);
+  m = pool.acquire();
+  TEST_EQUALITY(m.get(), addr);
+  TEST_EQUALITY(m->value, 0); // Reset when it was returned
+  RCP<Msg> m2 = pool.acquire(), m3 = pool.acquire();
+  TEST_EQUALITY(numLiveObjs, 3);
+  m = m2 = m3 = null;
+  const RCPObjectPoolStatistics stats = pool.getStatistics();
+  TEST_EQUALITY(stats.numHits, 3);
+  TEST_EQUALITY(stats.numMisses, 1);
+  TEST_EQUALITY(stats.numReleases, 4);
+  TEST_EQUALITY(stats.numDiscards, 0);
+}
+
+
+void weak_refs_to_returned_objects()
+{
+  pool_t pool;
+  RCP<Msg> m = pool.acquire();
+  RCP<Msg> w = m.create_weak();
+  m = null;
+  TEST_EQUALITY(w.strong_count(), 0);
+  TEST_ASSERT(is_null(w.create_strong_thread_safe()));
+  // The object's next use gets a new node
+  m = pool.acquire();
+  TEST_EQUALITY(m.strong_count(), 1);
+  TEST_EQUALITY(m.weak_count(), 0);
+  TEST_ASSERT(!w.shares_resource(m));
+}
+
+
+void rcpFromRef_finds_pool_node()
+{
+#ifdef TEUCHOS_DEBUG
+  if (!Teuchos::RCPNodeTracer::isTracingActiveRCPNodes())
+    return;
+  pool_t pool;
+  for (int i = 0; i < 3; ++i) {
+    RCP<Msg> m = pool.acquire();
+    RCP<Msg> ref = rcpFromRef(*m);
+    TEST_ASSERT(ref.shares_resource(m));
+    TEST_EQUALITY(m.weak_count(), 1);
+  }
+#endif
+}
+
+
+void max_cached_per_thread()
+{
+  pool_t pool(0, ClearMsg(), 2);
+  {
+    RCP<Msg> m[6];
+    for (int i = 0; i < 6; ++i)
+      m[i] = pool.acquire();
+    TEST_EQUALITY(numLiveObjs, 6);
+  }
+  // Two on the thread's list, two on the shared list
+  TEST_EQUALITY(numLiveObjs, 4);
+  TEST_EQUALITY(pool.getStatistics().numDiscards, 2);
+  {
+    RCP<Msg> m[4];
+    for (int i = 0; i < 4; ++i)
+      m[i] = pool.acquire();
+  }
+  TEST_EQUALITY(pool.getStatistics().numMisses, 6);
+  TEST_EQUALITY(pool.getStatistics().numHits, 4);
+}
+
+
+void pool_destroyed_before_objects()
+{
+  RCP<Msg> m;
+  {
+    pool_t pool(4);
+    m = pool.acquire();
+  }
+  TEST_EQUALITY(numLiveObjs, 4);
+  m = null;
+  TEST_EQUALITY(numLiveObjs, 0);
+}
+
+
+// A new pool that gets the id of a destroyed pool starts with empty lists
+void pool_ids_are_reused()
+{
+  for (int i = 0; i < 1000; ++i) {
+    pool_t pool(i % 3);
+    RCP<Msg> m1 = pool.acquire(), m2 = pool.acquire();
+    TEST_EQUALITY(numLiveObjs, 2);
+    m1 = null;
+    const RCPObjectPoolStatistics stats = pool.getStatistics();
+    TEST_EQUALITY(stats.numHits, i % 3);
+    TEST_EQUALITY(stats.numMisses, 2 - i % 3);
+    TEST_EQUALITY(stats.numReleases, 1);
+  }
+  TEST_EQUALITY(numLiveObjs, 0);
+}
+
+
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+// Objects created by one thread and released by another come back to the
+// producer through the shared list
+void producer_consumer_reuse()
+{
+  const int numMsgs = 20000;
+  pool_t pool(0, ClearMsg(), 256);
+  std::vector<RCP<Msg> > queue(numMsgs);
+  const int maxQueued = 256;
+  std::atomic<int> numProduced(0), numConsumed(0);
+  std::thread consumer([&]() {
+      for (int i = 0; i < numMsgs; ++i) {
+        while (numProduced.load() <= i)
+          std::this_thread::yield();
+        queue[i] = null;
+        numConsumed.store(i + 1);
+      }
+    });
+  for (int i = 0; i < numMsgs; ++i) {
+    while (i - numConsumed.load() >= maxQueued)
+      std::this_thread::yield();
+    queue[i] = pool.acquire();
+    numProduced.store(i + 1);
+  }
+  consumer.join();
+  const RCPObjectPoolStatistics stats = pool.getStatistics();
+  std::cout << "producer_consumer_reuse: " << stats << "\n";
+  TEST_EQUALITY(stats.numHits + stats.numMisses, numMsgs);
+  TEST_ASSERT(stats.numMisses < numMsgs / 10);
+  TEST_ASSERT(numLiveObjs <= maxQueued + 3 * 256);
+}
+#endif
+
+
+} // namespace
+
+
+int main()
+{
+  reuse_on_same_thread();
+  weak_refs_to_returned_objects();
+  rcpFromRef_finds_pool_node();
+  max_cached_per_thread();
+  pool_destroyed_before_objects();
+  pool_ids_are_reused();
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  producer_consumer_reuse();
+#endif
+  return unitTestResult();
+}
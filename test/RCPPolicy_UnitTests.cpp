@@ -0,0 +1,149 @@
+#include "Teuchos_RCPPolicy.hpp"
+#include "UnitTestHelpers.hpp"
+
+using Teuchos::RCP;
+using Teuchos::RCPPolicy;
+using Teuchos::RCPLeanPolicy;
+using Teuchos::RCPCountSingleThreaded;
+using Teuchos::rcp;
+using Teuchos::rcpWithPolicy;
+using Teuchos::rcpWithDefaultPolicy;
+using Teuchos::null;
+
+
+namespace {
+
+
+typedef RCPPolicy<RCPCountSingleThreaded,true,false,false> WeakPolicy;
+typedef RCPPolicy<RCPCountSingleThreaded,false,true,false> ExtraDataPolicy;
+typedef RCPPolicy<RCPCountSingleThreaded,false,false,true> TracedPolicy;
+
+
+int numLiveObjs = 0;
+
+struct A {
+  A() { ++numLiveObjs; }
+  virtual ~A() { --numLiveObjs; }
+};
+
+struct B : A {};
+
+
+void lean_counts_and_delete()
+{
+  {
+    RCP<A,RCPLeanPolicy> a = rcpWithPolicy<RCPLeanPolicy>(new A);
+    TEST_EQUALITY(a.strong_count(), 1);
+    TEST_EQUALITY(a.weak_count(), 0);
+    RCP<A,RCPLeanPolicy> a2 = a;
+    TEST_EQUALITY(a.strong_count(), 2);
+    TEST_ASSERT(a == a2);
+    a2 = null;
+    TEST_EQUALITY(a.strong_count(), 1);
+    TEST_EQUALITY(numLiveObjs, 1);
+  }
+  TEST_EQUALITY(numLiveObjs, 0);
+}
+
+
+void lean_nonowning()
+{
+  A a;
+  {
+    RCP<A,RCPLeanPolicy> ra = rcpWithPolicy<RCPLeanPolicy>(&a, false);
+    TEST_EQUALITY(ra.get(), &a);
+  }
+  TEST_EQUALITY(numLiveObjs, 1); // a not deleted
+}
+
+
+void derived_to_base_conversion()
+{
+  RCP<B,RCPLeanPolicy> b = rcpWithPolicy<RCPLeanPolicy>(new B);
+  RCP<A,RCPLeanPolicy> a = b;
+  TEST_EQUALITY(a.strong_count(), 2);
+  TEST_ASSERT(a.shares_resource(b));
+  b = null;
+  TEST_EQUALITY(numLiveObjs, 1);
+  a = null;
+  TEST_EQUALITY(numLiveObjs, 0);
+}
+
+
+void weak_promotion_fails_after_last_strong()
+{
+  RCP<A,WeakPolicy> a = rcpWithPolicy<WeakPolicy>(new A);
+  RCP<A,WeakPolicy> w = a.create_weak();
+  TEST_EQUALITY(a.strong_count(), 1);
+  TEST_EQUALITY(a.weak_count(), 1);
+  TEST_ASSERT(w.is_valid_ptr());
+  {
+    RCP<A,WeakPolicy> s = w.create_strong();
+    TEST_ASSERT(!s.is_null());
+    TEST_EQUALITY(a.strong_count(), 2);
+  }
+  a = null;
+  TEST_EQUALITY(numLiveObjs, 0);
+  TEST_ASSERT(!w.is_valid_ptr());
+  TEST_ASSERT(w.create_strong().is_null());
+}
+
+
+void extra_data()
+{
+  RCP<A,ExtraDataPolicy> a = rcpWithPolicy<ExtraDataPolicy>(new A);
+  Teuchos::set_extra_data(5, "five", Teuchos::outArg(a));
+  TEST_EQUALITY(Teuchos::get_extra_data<int>(a, "five"), 5);
+  TEST_ASSERT(Teuchos::get_optional_extra_data<int>(a, "six").get() == 0);
+}
+
+
+void default_policy_interop()
+{
+  RCP<A> a = rcp(new A);
+  {
+    RCP<A,RCPLeanPolicy> lean = rcpWithPolicy<RCPLeanPolicy>(a);
+    TEST_EQUALITY(lean.get(), a.get());
+    TEST_EQUALITY(a.strong_count(), 2); // Held by lean's node
+    RCP<A> back = rcpWithDefaultPolicy(lean);
+    TEST_EQUALITY(back.get(), a.get());
+  }
+  TEST_EQUALITY(a.strong_count(), 1);
+  a = null;
+  TEST_EQUALITY(numLiveObjs, 0);
+}
+
+
+#ifdef TEUCHOS_DEBUG
+void tracing()
+{
+  if (!Teuchos::RCPNodeTracer::isTracingActiveRCPNodes())
+    return;
+  const int numNodes = Teuchos::RCPNodeTracer::numActiveRCPNodes();
+  {
+    RCP<A,TracedPolicy> a = rcpWithPolicy<TracedPolicy>(new A);
+    TEST_EQUALITY(Teuchos::RCPNodeTracer::numActiveRCPNodes(), numNodes + 1);
+    RCP<A,RCPLeanPolicy> lean = rcpWithPolicy<RCPLeanPolicy>(new A);
+    TEST_EQUALITY(Teuchos::RCPNodeTracer::numActiveRCPNodes(), numNodes + 1);
+  }
+  TEST_EQUALITY(Teuchos::RCPNodeTracer::numActiveRCPNodes(), numNodes);
+}
+#endif
+
+
+} // namespace
+
+
+int main()
+{
+  lean_counts_and_delete();
+  lean_nonowning();
+  derived_to_base_conversion();
+  weak_promotion_fails_after_last_strong();
+  extra_data();
+  default_policy_interop();
+#ifdef TEUCHOS_DEBUG
+  tracing();
+#endif
+  return unitTestResult();
+}
@@ -0,0 +1,125 @@
+#include "Teuchos_RCPRegion.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <string>
+
+using Teuchos::RCP;
+using Teuchos::RCPRegion;
+using Teuchos::null;
+
+
+namespace {
+
+
+std::string events;
+
+
+struct Handler {
+  explicit Handler(const std::string &name) : name_(name), alive_(true) {}
+  ~Handler() { alive_ = false; events += "~" + name_ + " "; }
+  void handle() { TEST_ASSERT(alive_); }
+  std::string name_;
+  bool alive_;
+};
+
+
+struct Request {
+  Request() {}
+  ~Request()
+    {
+      // Still uses the handler that was created after it
+      if (nonnull(handler_))
+        handler_->handle();
+      events += "~Request ";
+    }
+  RCP<Handler> handler_;
+  RCP<Request> parent_; // Weak
+};
+
+
+void destroyed_after_referencing_objects()
+{
+  events.clear();
+  RCPRegion region;
+  RCP<Request> req = region.create<Request>();
+  req->handler_ = region.create<Handler>("h1");
+  RCP<Handler> h2 = region.create<Handler>("h2");
+  TEST_EQUALITY(region.numObjects(), 3u);
+  // The region keeps the objects alive
+  RCP<Handler> h1 = req->handler_.create_weak();
+  req = null;
+  TEST_EQUALITY(events, "");
+  TEST_EQUALITY(h1.strong_count(), 2); // The region and the request
+  h1 = null;
+  h2 = null;
+  region.release();
+  TEST_EQUALITY(events, "~h2 ~Request ~h1 ");
+  TEST_EQUALITY(region.numObjects(), 0u);
+}
+
+
+void weak_back_references()
+{
+  events.clear();
+  {
+    RCPRegion region;
+    RCP<Request> parent = region.create<Request>();
+    RCP<Request> child = region.create<Request>();
+    parent->handler_ = region.create<Handler>("h");
+    child->parent_ = parent.create_weak();
+  }
+  TEST_EQUALITY(events, "~Request ~Request ~h ");
+}
+
+
+void reuse_after_release()
+{
+  RCPRegion region(1024);
+  for (int i = 0; i < 100; ++i)
+    region.create<Handler>("h");
+  TEST_ASSERT(region.numBytesAllocated() > 1024u);
+  region.release();
+  TEST_EQUALITY(region.numBytesAllocated(), 1024u);
+  // Trivially destructible types need no record
+  RCP<int> a = region.create<int>(5);
+  TEST_EQUALITY(*a, 5);
+  TEST_EQUALITY(a.strong_count(), 1);
+  a = null;
+  RCP<Handler> h = region.create<Handler>("h");
+  TEST_EQUALITY(h.strong_count(), 2);
+  h = null;
+  region.release();
+  TEST_EQUALITY(region.numObjects(), 0u);
+}
+
+
+void outside_reference_aborts()
+{
+#ifdef TEUCHOS_DEBUG
+  TEST_ABORTS([]() {
+      RCP<Handler> h;
+      RCPRegion region;
+      h = region.create<Handler>("h");
+    });
+  TEST_ABORTS([]() {
+      RCPRegion region;
+      RCP<Request> a = region.create<Request>();
+      RCP<Request> b = region.create<Request>();
+      a->parent_ = b;
+      b->parent_ = a;
+    });
+#endif
+}
+
+
+} // namespace
+
+
+int main()
+{
+  destroyed_after_referencing_objects();
+  weak_back_references();
+  reuse_after_release();
+  outside_reference_aborts();
+  return unitTestResult();
+}
@@ -0,0 +1,141 @@
+#include "Teuchos_RCP.hpp"
+#include "UnitTestHelpers.hpp"
+
+#ifndef HAVE_TEUCHOS_THREAD_SAFE
+#  error "Only built with TEUCHOS_ENABLE_THREAD_SAFE=ON"
+#endif
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+using Teuchos::null;
+
+
+namespace {
+
+
+const int numIters = 20000;
+
+
+std::vector<std::atomic<bool> > &deletedFlags()
+{
+  static std::vector<std::atomic<bool> > s_flags(numIters);
+  return s_flags;
+}
+
+
+struct A {
+  explicit A(int i) : i_(i) {}
+  ~A() { deletedFlags()[i_].store(true); }
+  int i_;
+};
+
+
+// Lets two threads start each iteration together
+class SpinBarrier {
+public:
+  SpinBarrier() : count_(0), generation_(0) {}
+  void wait()
+    {
+      const int generation = generation_.load();
+      if (count_.fetch_add(1) == 1) {
+        count_.store(0);
+        generation_.fetch_add(1);
+      }
+      else {
+        while (generation_.load() == generation)
+          std::this_thread::yield();
+      }
+    }
+private:
+  std::atomic<int> count_;
+  std::atomic<int> generation_;
+};
+
+
+// One thread releases the last strong reference while the other promotes a
+// weak reference.  A promotion that succeeds must keep the object alive.
+void promote_while_releasing_last_strong()
+{
+  std::vector<RCP<A> > strongs(numIters);
+  std::vector<RCP<A> > weaks(numIters);
+  for (int i = 0; i < numIters; ++i) {
+    strongs[i] = rcp(new A(i));
+    weaks[i] = strongs[i].create_weak();
+  }
+  SpinBarrier barrier;
+  std::atomic<int> numPromoted(0), numDeletedWhileHeld(0);
+  std::thread releaser([&]() {
+      for (int i = 0; i < numIters; ++i) {
+        barrier.wait();
+        strongs[i] = null;
+      }
+    });
+  std::thread promoter([&]() {
+      for (int i = 0; i < numIters; ++i) {
+        barrier.wait();
+        RCP<A> s = weaks[i].create_strong_thread_safe();
+        if (!s.is_null()) {
+          ++numPromoted;
+          for (int k = 0; k < 50; ++k) {
+            if (deletedFlags()[i].load()) {
+              ++numDeletedWhileHeld;
+              break;
+            }
+          }
+        }
+      }
+    });
+  releaser.join();
+  promoter.join();
+  TEST_EQUALITY(numDeletedWhileHeld.load(), 0);
+  for (int i = 0; i < numIters; ++i) {
+    TEST_ASSERT(deletedFlags()[i].load());
+    TEST_EQUALITY(weaks[i].strong_count(), 0);
+    TEST_EQUALITY(weaks[i].weak_count(), 1);
+    if (!deletedFlags()[i].load())
+      break;
+  }
+  std::cout << "Promoted " << numPromoted.load() << " of " << numIters << "\n";
+}
+
+
+// Copies and releases of one object on several threads keep exact counts
+void concurrent_copies()
+{
+  const int numThreads = 4;
+  RCP<A> a = rcp(new A(0));
+  deletedFlags()[0].store(false);
+  RCP<A> w = a.create_weak();
+  std::vector<std::thread> threads;
+  for (int t = 0; t < numThreads; ++t) {
+    threads.push_back(std::thread([&]() {
+        for (int i = 0; i < 20000; ++i) {
+          RCP<A> s = a;
+          RCP<A> ws = w.create_strong_thread_safe();
+          RCP<A> w2 = w;
+        }
+      }));
+  }
+  for (int t = 0; t < numThreads; ++t)
+    threads[t].join();
+  TEST_EQUALITY(a.strong_count(), 1);
+  TEST_EQUALITY(a.weak_count(), 1);
+  a = null;
+  TEST_ASSERT(deletedFlags()[0].load());
+  TEST_EQUALITY(w.weak_count(), 1);
+}
+
+
+} // namespace
+
+
+int main()
+{
+  promote_while_releasing_last_strong();
+  concurrent_copies();
+  return unitTestResult();
+}
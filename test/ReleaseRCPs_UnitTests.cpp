@@ -0,0 +1,137 @@
+#include "Teuchos_RCPBulk.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <list>
+#include <stdexcept>
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+using Teuchos::releaseRCPs;
+using Teuchos::null;
+
+
+namespace {
+
+
+int numLiveObjs = 0;
+
+struct A {
+  A() { ++numLiveObjs; }
+  ~A() { --numLiveObjs; }
+  RCP<A> other;
+};
+
+
+// Fails to delete the object the first time
+class ThrowingDealloc {
+public:
+  typedef A ptr_t;
+  ThrowingDealloc() : numCalls_(0) {}
+  void free(A* p)
+    {
+      if (++numCalls_ == 1)
+        throw std::runtime_error("ThrowingDealloc");
+      delete p;
+    }
+private:
+  int numCalls_;
+};
+
+
+void release_mixed_references(bool groupByNode)
+{
+  RCP<A> kept = rcp(new A);
+  RCP<A> a = rcp(new A), b = rcp(new A);
+  std::vector<RCP<A> > rcps;
+  for (int i = 0; i < 10; ++i) {
+    rcps.push_back(a);
+    rcps.push_back(kept);
+    rcps.push_back(RCP<A>());
+    rcps.push_back(b.create_weak());
+    rcps.push_back(rcp(new A));
+  }
+  rcps.push_back(b);
+  RCP<A> bWeak = b.create_weak();
+  a = b = null;
+  TEST_EQUALITY(numLiveObjs, 13);
+  TEST_EQUALITY(kept.strong_count(), 11);
+  releaseRCPs(rcps, groupByNode);
+  TEST_ASSERT(rcps.empty());
+  TEST_EQUALITY(numLiveObjs, 1);
+  TEST_EQUALITY(kept.strong_count(), 1);
+  TEST_EQUALITY(kept.weak_count(), 0);
+  TEST_EQUALITY(bWeak.strong_count(), 0);
+  TEST_EQUALITY(bWeak.weak_count(), 1);
+}
+
+
+void release_iterator_range()
+{
+  std::list<RCP<A> > rcps;
+  RCP<A> a = rcp(new A);
+  rcps.push_back(a);
+  rcps.push_back(a.create_weak());
+  rcps.push_back(rcp(new A));
+  releaseRCPs(rcps.begin(), rcps.end());
+  TEST_EQUALITY(rcps.size(), 3u);
+  for (std::list<RCP<A> >::iterator itr = rcps.begin(); itr != rcps.end(); ++itr)
+    TEST_ASSERT(is_null(*itr));
+  TEST_EQUALITY(numLiveObjs, 1);
+  TEST_EQUALITY(a.strong_count(), 1);
+  TEST_EQUALITY(a.weak_count(), 0);
+  releaseRCPs(rcps.begin(), rcps.end());
+}
+
+
+void objects_referencing_each_other()
+{
+  std::vector<RCP<A> > rcps;
+  for (int i = 0; i < 20; ++i) {
+    rcps.push_back(rcp(new A));
+    if (i > 0)
+      rcps[i]->other = rcps[i - 1];
+  }
+  // Weak cycle back to the last object
+  rcps[0]->other = rcps[19].create_weak();
+  releaseRCPs(rcps);
+  TEST_EQUALITY(numLiveObjs, 0);
+}
+
+
+void throwing_destructor()
+{
+#ifdef TEUCHOS_DEBUG
+  // In a debug build the object that failed to be deleted and the RCPs not
+  // released yet are left as they were
+  std::vector<RCP<A> > rcps;
+  rcps.push_back(Teuchos::rcpWithDealloc(new A, ThrowingDealloc()));
+  rcps.push_back(rcp(new A));
+  RCP<A> a = rcp(new A);
+  rcps.push_back(a);
+  TEST_THROW(releaseRCPs(rcps), std::runtime_error);
+  TEST_EQUALITY(rcps.size(), 3u);
+  TEST_EQUALITY(rcps[0].strong_count(), 1);
+  TEST_ASSERT(is_null(rcps[1]) || rcps[1].strong_count() == 1);
+  TEST_ASSERT(is_null(rcps[2]));
+  TEST_EQUALITY(a.strong_count(), 1);
+  TEST_EQUALITY(numLiveObjs, is_null(rcps[1]) ? 2 : 3);
+  releaseRCPs(rcps);
+  a = null;
+  TEST_EQUALITY(numLiveObjs, 0);
+#endif
+}
+
+
+} // namespace
+
+
+int main()
+{
+  release_mixed_references(true);
+  release_mixed_references(false);
+  TEST_EQUALITY(numLiveObjs, 0);
+  release_iterator_range();
+  objects_referencing_each_other();
+  throwing_destructor();
+  return unitTestResult();
+}
@@ -0,0 +1,130 @@
+#include "Teuchos_SlotMap.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <cstdint>
+#include <string>
+
+using Teuchos::RCP;
+using Teuchos::SlotMap;
+using Teuchos::SlotMapHandle;
+using Teuchos::null;
+
+
+namespace {
+
+
+int numLiveObjs = 0;
+
+struct A {
+  explicit A(int v) : value(v) { ++numLiveObjs; }
+  ~A() { --numLiveObjs; }
+  int value;
+};
+
+struct alignas(64) Aligned {
+  Aligned() : value(0) {}
+  double value;
+};
+
+
+void insert_get_erase()
+{
+  SlotMap<A> map;
+  TEST_ASSERT(map.empty());
+  SlotMapHandle h1 = map.insert(1), h2 = map.insert(2);
+  TEST_EQUALITY(map.size(), 2u);
+  TEST_EQUALITY(map.get(h1)->value, 1);
+  TEST_EQUALITY(map.get(h2)->value, 2);
+  TEST_ASSERT(map.get(SlotMapHandle()) == 0);
+  TEST_ASSERT(map.erase(h1));
+  TEST_ASSERT(!map.erase(h1));
+  TEST_ASSERT(map.get(h1) == 0);
+  TEST_EQUALITY(numLiveObjs, 1);
+  // The slot is reused but the old handle stays invalid
+  SlotMapHandle h3 = map.insert(3);
+  TEST_EQUALITY(h3.index, h1.index);
+  TEST_ASSERT(h3 != h1);
+  TEST_ASSERT(!map.contains(h1));
+  TEST_EQUALITY(map.get(h3)->value, 3);
+  int sum = 0;
+  map.for_each([&](A &a) { sum += a.value; });
+  TEST_EQUALITY(sum, 5);
+}
+
+
+void objects_do_not_move()
+{
+  SlotMap<A> map;
+  SlotMapHandle h0 = map.insert(0);
+  A *p0 = map.get(h0);
+  for (std::uint32_t i = 1; i < 3 * SlotMap<A>::pageSize; ++i)
+    map.insert(static_cast<int>(i));
+  TEST_EQUALITY(map.get(h0), p0);
+  TEST_EQUALITY(map.size(), 3u * SlotMap<A>::pageSize);
+}
+
+
+void rcp_pins_erased_object()
+{
+  SlotMap<A> map;
+  SlotMapHandle h = map.insert(7);
+  RCP<A> a = map.getRCP(h);
+  RCP<A> a2 = map.getRCP(h);
+  TEST_EQUALITY(a->value, 7);
+  TEST_ASSERT(map.erase(h));
+  TEST_ASSERT(!map.contains(h));
+  TEST_ASSERT(is_null(map.getRCP(h)));
+  TEST_EQUALITY(map.size(), 0u);
+  TEST_EQUALITY(numLiveObjs, 1);
+  int numVisited = 0;
+  map.for_each([&](A&) { ++numVisited; });
+  TEST_EQUALITY(numVisited, 0);
+  // The slot is not reused while pinned
+  SlotMapHandle h2 = map.insert(8);
+  TEST_ASSERT(h2.index != h.index);
+  a = null;
+  TEST_EQUALITY(numLiveObjs, 2);
+  a2 = null;
+  TEST_EQUALITY(numLiveObjs, 1);
+  // Unpinning a live object does not erase it
+  RCP<A> b = map.getRCP(h2);
+  b = null;
+  TEST_ASSERT(map.contains(h2));
+}
+
+
+void over_aligned_objects()
+{
+  SlotMap<Aligned> map;
+  for (int i = 0; i < 100; ++i) {
+    Aligned *p = map.get(map.insert());
+    TEST_EQUALITY(reinterpret_cast<std::uintptr_t>(p) % 64, 0u);
+  }
+}
+
+
+void pinned_at_destruction_aborts()
+{
+#ifdef TEUCHOS_DEBUG
+  TEST_ABORTS([]() {
+      RCP<A> a;
+      SlotMap<A> map;
+      a = map.getRCP(map.insert(1));
+    });
+#endif
+}
+
+
+} // namespace
+
+
+int main()
+{
+  insert_get_erase();
+  objects_do_not_move();
+  rcp_pins_erased_object();
+  over_aligned_objects();
+  pinned_at_destruction_aborts();
+  TEST_EQUALITY(numLiveObjs, 0);
+  return unitTestResult();
+}
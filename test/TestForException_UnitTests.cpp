@@ -0,0 +1,142 @@
+#include "Teuchos_TestForException.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+
+namespace {
+
+
+const char *expectedName = "";
+const char *expectedMsgPart = "";
+
+// Returns (so the program is aborted) only if it got the expected error,
+// otherwise the child process exits normally and the test fails
+void checkingHandler( const char *exceptionName, const std::string &msg )
+{
+  if (std::string(exceptionName) != expectedName
+    || msg.find(expectedMsgPart) == std::string::npos
+    || msg.find("TestForException_UnitTests.cpp") == std::string::npos)
+  {
+    std::_Exit(0);
+  }
+}
+
+
+void error_handler_gets_name_and_message()
+{
+  TEST_ABORTS([]() {
+      TestForException_setErrorHandler(&checkingHandler);
+      expectedName = "std::logic_error";
+      expectedMsgPart = "value = 42";
+      TEST_FOR_TERMINATION(true, "value = " << 42);
+    });
+  // The handler is really called: one that rejects the message keeps the
+  // program from being aborted
+  TEST_ASSERT(!unitTestAborts([]() {
+      TestForException_setErrorHandler(&checkingHandler);
+      expectedName = "std::logic_error";
+      expectedMsgPart = "value = 43";
+      TEST_FOR_TERMINATION(true, "value = " << 42);
+    }));
+}
+
+
+void null_restores_default_handler()
+{
+  const TestForException_ErrorHandler defaultHandler =
+    TestForException_setErrorHandler(&checkingHandler);
+  TEST_ASSERT(defaultHandler != 0);
+  TEST_ASSERT(defaultHandler != &checkingHandler);
+  TEST_ASSERT(TestForException_setErrorHandler(0) == &checkingHandler);
+  TEST_ASSERT(TestForException_setErrorHandler(0) == defaultHandler);
+  // The default handler aborts even where checkingHandler would not
+  TEST_ABORTS([]() {
+      TestForException_setErrorHandler(&checkingHandler);
+      TestForException_setErrorHandler(0);
+      expectedName = "none";
+      TEST_FOR_TERMINATION(true, "value = " << 42);
+    });
+}
+
+
+int numMsgEvals = 0;
+
+int countMsgEval()
+{
+  return ++numMsgEvals;
+}
+
+
+void msg_only_evaluated_on_failure()
+{
+  numMsgEvals = 0;
+  TEST_FOR_EXCEPTION(false, std::logic_error, "eval " << countMsgEval());
+  TEST_FOR_EXCEPTION_PURE_MSG(false, std::logic_error, "eval " << countMsgEval());
+  TEST_FOR_EXCEPT_MSG(false, "eval " << countMsgEval());
+  TEST_FOR_TERMINATION(false, "eval " << countMsgEval());
+  TEST_EQUALITY(numMsgEvals, 0);
+  TEST_THROW(TEST_FOR_EXCEPT_MSG(true, "eval " << countMsgEval()),
+    std::logic_error);
+  TEST_EQUALITY(numMsgEvals, 1);
+}
+
+
+// The message has the same layout as when it was formed inline by the macro
+void except_msg_format()
+{
+  const int n = 125;
+  std::string what;
+  int line = 0;
+  try {
+    line = __LINE__; TEST_FOR_EXCEPT_MSG(n > 100, "Error, n = " << n << " is bad");
+  }
+  catch (const std::logic_error &e) {
+    what = e.what();
+  }
+  std::ostringstream head;
+  head
+    << __FILE__ << ":" << line << ":\n\n"
+    << "Throw number = " << TestForException_getThrowNumber() << "\n\n"
+    << "Throw test that evaluated to true: n > 100\n\n";
+  const std::string tail = "\nError, n = 125 is bad";
+  TEST_EQUALITY(what.substr(0, head.str().size()), head.str());
+  TEST_ASSERT(what.size() >= head.str().size() + tail.size());
+  TEST_EQUALITY(what.substr(what.size() - tail.size()), tail);
+}
+
+
+// Just the message and the throw number, no file, test or backtrace
+void pure_msg_format()
+{
+  const int n = 125;
+  std::string what;
+  try {
+    TEST_FOR_EXCEPTION_PURE_MSG(n > 100, std::out_of_range,
+      "Error, n = " << n << " is bad");
+  }
+  catch (const std::out_of_range &e) {
+    what = e.what();
+  }
+  std::ostringstream expected;
+  expected
+    << "Error, n = 125 is bad\n\nThrow number = "
+    << TestForException_getThrowNumber() << "\n\n";
+  TEST_EQUALITY(what, expected.str());
+}
+
+
+} // namespace
+
+
+int main()
+{
+  error_handler_gets_name_and_message();
+  null_restores_default_handler();
+  msg_only_evaluated_on_failure();
+  except_msg_format();
+  pure_msg_format();
+  return unitTestResult();
+}
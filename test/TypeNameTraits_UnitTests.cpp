@@ -0,0 +1,49 @@
+#include "Teuchos_RCP.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <string>
+#include <vector>
+
+using Teuchos::RCP;
+using Teuchos::TypeNameTraits;
+using Teuchos::typeName;
+
+
+// Outside of the anonymous namespace, which compilers spell differently
+struct Base { virtual ~Base() {} };
+
+struct Derived : Base {};
+
+
+namespace {
+
+
+void static_and_concrete_names_agree()
+{
+  std::vector<int> v;
+  TEST_EQUALITY(typeName(v), TypeNameTraits<std::vector<int> >::name());
+  RCP<Base> p;
+  TEST_EQUALITY(typeName(p), TypeNameTraits<RCP<Base> >::name());
+  Base b;
+  TEST_EQUALITY(typeName(b), TypeNameTraits<Base>::name());
+}
+
+
+void concrete_name_is_dynamic_type()
+{
+  Derived d;
+  const Base &b = d;
+  TEST_EQUALITY(typeName(b), TypeNameTraits<Derived>::name());
+  TEST_EQUALITY(typeName(b), std::string("Derived"));
+}
+
+
+} // namespace
+
+
+int main()
+{
+  static_and_concrete_names_agree();
+  concrete_name_is_dynamic_type();
+  return unitTestResult();
+}
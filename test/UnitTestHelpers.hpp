@@ -0,0 +1,94 @@
+#ifndef TEUCHOS_UNIT_TEST_HELPERS_HPP
+#define TEUCHOS_UNIT_TEST_HELPERS_HPP
+
+// Minimal checks for the unit tests in this directory.  Each test program
+// calls its test functions from main() and returns unitTestResult().
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <csignal>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+
+inline int& unitTestFailures()
+{
+  static int s_failures = 0;
+  return s_failures;
+}
+
+
+inline void unitTestFailed(const char *file, int line, const char *what)
+{
+  std::cerr << file << ":" << line << ": FAILED: " << what << "\n";
+  ++unitTestFailures();
+}
+
+
+inline int unitTestResult()
+{
+  if (unitTestFailures())
+    std::cerr << unitTestFailures() << " check(s) FAILED\n";
+  else
+    std::cout << "End Result: TEST PASSED\n";
+  return unitTestFailures() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+
+// Runs code in a child process and returns true if it aborted
+template<class Func>
+bool unitTestAborts(Func code)
+{
+  std::cout.flush();
+  std::cerr.flush();
+  const pid_t pid = fork();
+  if (pid == 0) {
+    // Keep the expected error report out of the test output
+    if (!std::getenv("TEUCHOS_TEST_SHOW_ABORTS"))
+      if (!std::freopen("/dev/null", "w", stderr)) {}
+    code();
+    std::_Exit(0);
+  }
+  int status = 0;
+  waitpid(pid, &status, 0);
+  return WIFSIGNALED(status) && WTERMSIG(status) == SIGABRT;
+}
+
+
+#define TEST_ASSERT(cond) \
+  { if (!(cond)) unitTestFailed(__FILE__, __LINE__, #cond); }
+
+#define TEST_EQUALITY(v1, v2) \
+  { \
+    if (!((v1) == (v2))) { \
+      std::cerr << "  " #v1 " = " << (v1) << ", " #v2 " = " << (v2) << "\n"; \
+      unitTestFailed(__FILE__, __LINE__, #v1 " == " #v2); \
+    } \
+  }
+
+#define TEST_THROW(code, Exception) \
+  { \
+    bool caught = false; \
+    try { code; } \
+    catch (const Exception&) { caught = true; } \
+    if (!caught) \
+      unitTestFailed(__FILE__, __LINE__, #code " throws " #Exception); \
+  }
+
+#define TEST_NOTHROW(code) \
+  { \
+    try { code; } \
+    catch (const std::exception &e) { \
+      std::cerr << "  " << e.what() << "\n"; \
+      unitTestFailed(__FILE__, __LINE__, #code " does not throw"); \
+    } \
+  }
+
+// Checks that code (a lambda) reports an error and aborts the program
+#define TEST_ABORTS(code) \
+  { if (!unitTestAborts(code)) unitTestFailed(__FILE__, __LINE__, #code " aborts"); }
+
+
+#endif // TEUCHOS_UNIT_TEST_HELPERS_HPP
@@ -0,0 +1,173 @@
+#include "Teuchos_WeakRCPCache.hpp"
+#include "UnitTestHelpers.hpp"
+
+#include <new>
+#include <string>
+
+using Teuchos::RCP;
+using Teuchos::WeakRCPCache;
+using Teuchos::rcp;
+using Teuchos::null;
+
+
+// Counts the live heap allocations to check that entries do not leak
+namespace { long numLiveAllocs = 0; }
+
+void* operator new(std::size_t size)
+{
+  void *p = std::malloc(size ? size : 1);
+  if (!p)
+    throw std::bad_alloc();
+  ++numLiveAllocs;
+  return p;
+}
+
+void operator delete(void *p) noexcept
+{
+  if (p) {
+    --numLiveAllocs;
+    std::free(p);
+  }
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+  operator delete(p);
+}
+
+
+namespace {
+
+
+typedef WeakRCPCache<std::string, const int> cache_t;
+
+
+int numLiveObjs = 0;
+
+struct A {
+  explicit A(int v) : value(v) { ++numLiveObjs; }
+  ~A() { --numLiveObjs; }
+  int value;
+};
+
+
+void get_does_not_keep_alive()
+{
+  cache_t cache;
+  RCP<const int> a = rcp(new int(1));
+  TEST_ASSERT(cache.insert("a", a) == a);
+  TEST_EQUALITY(a.strong_count(), 1);
+  TEST_EQUALITY(a.weak_count(), 1);
+  {
+    RCP<const int> a2 = cache.get("a");
+    TEST_ASSERT(a2 == a);
+    TEST_EQUALITY(a.strong_count(), 2);
+  }
+  TEST_ASSERT(is_null(cache.get("b")));
+  // The entry goes away with the last strong reference
+  a = null;
+  TEST_ASSERT(is_null(cache.get("a")));
+  TEST_EQUALITY(cache.size(), 0u);
+}
+
+
+void insert_returns_live_object()
+{
+  cache_t cache;
+  RCP<const int> a = rcp(new int(1));
+  RCP<const int> b = rcp(new int(2));
+  cache.insert("k", a);
+  TEST_ASSERT(cache.insert("k", b) == a);
+  a = null;
+  TEST_ASSERT(cache.insert("k", b) == b);
+  TEST_ASSERT(cache.get("k") == b);
+  TEST_THROW(cache.insert("k", null), std::invalid_argument);
+}
+
+
+void get_or_create()
+{
+  WeakRCPCache<int, A> cache;
+  int numCreated = 0;
+  RCP<A> a = cache.getOrCreate(1, [&]() { ++numCreated; return rcp(new A(1)); });
+  RCP<A> a2 = cache.getOrCreate(1, [&]() { ++numCreated; return rcp(new A(1)); });
+  TEST_ASSERT(a == a2);
+  TEST_EQUALITY(numCreated, 1);
+  a = null;
+  a2 = null;
+  TEST_EQUALITY(numLiveObjs, 0);
+  a = cache.getOrCreate(1, [&]() { ++numCreated; return rcp(new A(2)); });
+  TEST_EQUALITY(numCreated, 2);
+  TEST_EQUALITY(a->value, 2);
+}
+
+
+void erase_and_clear_keep_objects()
+{
+  WeakRCPCache<int, A> cache;
+  RCP<A> a = rcp(new A(1)), b = rcp(new A(2));
+  cache.insert(1, a);
+  cache.insert(2, b);
+  TEST_ASSERT(cache.erase(1));
+  TEST_ASSERT(!cache.erase(1));
+  TEST_ASSERT(is_null(cache.get(1)));
+  TEST_EQUALITY(a.weak_count(), 0);
+  TEST_EQUALITY(a->value, 1);
+  cache.clear();
+  TEST_EQUALITY(cache.size(), 0u);
+  TEST_EQUALITY(b.weak_count(), 0);
+  TEST_EQUALITY(numLiveObjs, 2);
+  // A new entry for the key is not removed by the old object going away
+  RCP<A> c = rcp(new A(3));
+  cache.insert(2, c);
+  b = null;
+  TEST_ASSERT(cache.get(2) == c);
+}
+
+
+void erase_detaches_destroy_hook()
+{
+  WeakRCPCache<int, A> cache;
+  RCP<A> a = rcp(new A(1));
+  long numAllocs = 0;
+  for (int i = 0; i < 1000; ++i) {
+    if (i == 1)
+      numAllocs = numLiveAllocs;
+    cache.insert(1, a);
+    cache.erase(1);
+    cache.insert(2, a);
+    cache.clear();
+  }
+  TEST_EQUALITY(numLiveAllocs, numAllocs);
+  a = null;
+  TEST_EQUALITY(numLiveObjs, 0);
+}
+
+
+void cache_destroyed_first()
+{
+  RCP<A> a = rcp(new A(1));
+  {
+    WeakRCPCache<int, A> cache;
+    cache.insert(1, a);
+    TEST_EQUALITY(a.weak_count(), 1);
+  }
+  TEST_EQUALITY(a.weak_count(), 0);
+  a = null;
+  TEST_EQUALITY(numLiveObjs, 0);
+}
+
+
+} // namespace
+
+
+int main()
+{
+  get_does_not_keep_alive();
+  insert_returns_live_object();
+  get_or_create();
+  erase_and_clear_keep_objects();
+  erase_detaches_destroy_hook();
+  cache_destroyed_first();
+  return unitTestResult();
+}